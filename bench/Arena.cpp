@@ -0,0 +1,75 @@
+// A burst of 1000 failures with owned error messages: geode::Error from the
+// global allocator against an ErrorArena released after every burst, with
+// several threads failing at once to show allocator contention
+#include "Bench.hpp"
+
+#include <Geode/result/Arena.hpp>
+
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    constexpr int BurstSize = 1000;
+
+    GEODE_BENCH_NOINLINE Result<int, Error> lookup(std::string_view key) {
+        // formatted on the stack, so the only allocation is the Error's own copy
+        constexpr std::string_view prefix = "upstream unavailable while looking up ";
+        char message[128] = {};
+        prefix.copy(message, prefix.size());
+        key.copy(message + prefix.size(), sizeof(message) - prefix.size() - 1);
+        return Err(message);
+    }
+
+    void burst() {
+        for (int i = 0; i < BurstSize; ++i) {
+            auto res = lookup("user/profile/settings");
+            doNotOptimize(res);
+        }
+    }
+
+    void arenaBurst(ErrorArena& arena) {
+        {
+            ErrorArena::Scope scope(arena);
+            burst();
+        }
+        arena.release();
+    }
+
+    template <class Work>
+    void onThreads(std::size_t iterations, int threads, Work work) {
+        std::vector<std::jthread> pool;
+        for (int t = 0; t < threads; ++t) {
+            pool.emplace_back([&] {
+                ErrorArena arena;
+                for (std::size_t i = 0; i < iterations; ++i) {
+                    work(arena);
+                }
+            });
+        }
+    }
+}
+
+GEODE_BENCH("error burst 1000", "global allocator") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        burst();
+    }
+}
+
+GEODE_BENCH("error burst 1000", "ErrorArena") {
+    ErrorArena arena;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        arenaBurst(arena);
+    }
+}
+
+GEODE_BENCH("error burst 1000 x 4 threads", "global allocator") {
+    onThreads(iterations, 4, [](ErrorArena&) { burst(); });
+}
+
+GEODE_BENCH("error burst 1000 x 4 threads", "ErrorArena") {
+    onThreads(iterations, 4, arenaBurst);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Geode/Result.hpp>
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+// Keeps the functions under test as real calls, so that every approach pays
+// for returning its result through the ABI instead of being folded away
+#if defined(__clang__)
+    #define GEODE_BENCH_NOINLINE [[gnu::noinline]]
+#elif defined(__GNUC__)
+    #define GEODE_BENCH_NOINLINE [[gnu::noipa]]
+#elif defined(_MSC_VER)
+    #define GEODE_BENCH_NOINLINE __declspec(noinline)
+#else
+    #define GEODE_BENCH_NOINLINE
+#endif
+
+// Defines and registers a benchmark, the body runs the operation `iterations` times
+#define GEODE_BENCH(group, name)                                                         \
+    static void GEODE_CONCAT(benchFunction, __LINE__)(std::size_t iterations);           \
+    static bench::Register GEODE_CONCAT(benchRegister, __LINE__)(                        \
+        group, name, &GEODE_CONCAT(benchFunction, __LINE__)                              \
+    );                                                                                   \
+    static void GEODE_CONCAT(benchFunction, __LINE__)([[maybe_unused]] std::size_t iterations)
+
+namespace bench {
+    using Function = void (*)(std::size_t iterations);
+
+    struct Case {
+        std::string_view group;
+        std::string_view name;
+        Function function;
+    };
+
+    /// @brief All registered benchmarks, in registration order
+    std::vector<Case>& cases();
+
+    /// @brief Number of calls to operator new made so far by this program
+    std::size_t allocations() noexcept;
+
+    struct Register {
+        Register(std::string_view group, std::string_view name, Function function) {
+            cases().push_back(Case{group, name, function});
+        }
+    };
+
+    /// @brief Forces the compiler to assume the value is read
+    template <class Type>
+    inline void doNotOptimize(Type const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        auto volatile sink = &value;
+        (void)sink;
+#endif
+    }
+
+    /// @brief Returns the value without letting the compiler know what it is
+    template <class Type>
+    inline Type opaque(Type value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : "+r"(value));
+        return value;
+#else
+        Type volatile copy = value;
+        return copy;
+#endif
+    }
+
+    /// @brief Message used by every error path, long enough to not fit in
+    /// the small string buffer of the common standard libraries
+    inline constexpr char const* errorMessage = "value must not be negative";
+}
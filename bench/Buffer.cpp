@@ -0,0 +1,139 @@
+// Bulk status checks on a ResultBuffer compared with a std::vector of Results
+#include "Bench.hpp"
+
+#include <Geode/result/Buffer.hpp>
+
+#include <cstdint>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    constexpr std::size_t BatchSize = 1 << 16;
+
+    enum class ErrCode : std::uint8_t {
+        Overflow,
+        NotANumber,
+    };
+
+    bool failsAt(std::size_t i) {
+        // the first Err is half way through the batch
+        return i >= BatchSize / 2 && (i * 2654435761u) % 97 == 0;
+    }
+
+    std::vector<Result<float, ErrCode>> const& vectorBatch() {
+        static auto results = [] {
+            std::vector<Result<float, ErrCode>> results;
+            results.reserve(BatchSize);
+            for (std::size_t i = 0; i < BatchSize; ++i) {
+                if (failsAt(i)) {
+                    results.push_back(Err(ErrCode::Overflow));
+                }
+                else {
+                    results.push_back(Ok(static_cast<float>(i)));
+                }
+            }
+            return results;
+        }();
+        return results;
+    }
+
+    ResultBuffer<float, ErrCode> const& bufferBatch() {
+        static auto buffer = [] {
+            ResultBuffer<float, ErrCode> buffer;
+            buffer.reserve(BatchSize);
+            for (std::size_t i = 0; i < BatchSize; ++i) {
+                if (failsAt(i)) {
+                    buffer.pushErr(ErrCode::Overflow);
+                }
+                else {
+                    buffer.pushOk(static_cast<float>(i));
+                }
+            }
+            return buffer;
+        }();
+        return buffer;
+    }
+}
+
+GEODE_BENCH("count errs 64k", "std::vector<Result>") {
+    auto& results = vectorBatch();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::size_t count = 0;
+        for (auto const& res : opaque(&results)[0]) {
+            count += res.isErr();
+        }
+        doNotOptimize(count);
+    }
+}
+
+GEODE_BENCH("count errs 64k", "ResultBuffer") {
+    auto& buffer = bufferBatch();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        doNotOptimize(opaque(&buffer)->countErr(0, BatchSize));
+    }
+}
+
+GEODE_BENCH("first err 64k", "std::vector<Result>") {
+    auto& results = vectorBatch();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::size_t index = 0;
+        for (auto const& res : opaque(&results)[0]) {
+            if (res.isErr()) break;
+            ++index;
+        }
+        doNotOptimize(index);
+    }
+}
+
+GEODE_BENCH("first err 64k", "ResultBuffer") {
+    auto& buffer = bufferBatch();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        doNotOptimize(opaque(&buffer)->firstErr());
+    }
+}
+
+GEODE_BENCH("extract oks 64k", "std::vector<Result>") {
+    auto& results = vectorBatch();
+    std::vector<float> oks;
+    oks.reserve(BatchSize);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        oks.clear();
+        for (auto const& res : opaque(&results)[0]) {
+            if (res.isOk()) {
+                oks.push_back(res.unwrap());
+            }
+        }
+        doNotOptimize(oks);
+    }
+}
+
+GEODE_BENCH("extract oks 64k", "ResultBuffer") {
+    auto& buffer = bufferBatch();
+    std::vector<float> oks;
+    oks.reserve(BatchSize);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto compact = opaque(&buffer)->compactOks();
+        oks.assign(compact.begin(), compact.end());
+        doNotOptimize(oks);
+    }
+}
+
+GEODE_BENCH("random access 64k", "std::vector<Result>") {
+    auto& results = vectorBatch();
+    float sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += results[(i * 40503u) % BatchSize].unwrapOr(0.f);
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("random access 64k", "ResultBuffer") {
+    auto& buffer = bufferBatch();
+    float sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = buffer.at((i * 40503u) % BatchSize);
+        sum += res.isOk() ? res.unwrap() : 0.f;
+    }
+    doNotOptimize(sum);
+}
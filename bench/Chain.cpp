@@ -0,0 +1,124 @@
+// map/andThen chains compared with the equivalent control flow, std::expected
+// only takes part when its monadic operations are available
+#include "Operations.hpp"
+
+#include <stdexcept>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    int increment(int value) {
+        return value + 1;
+    }
+
+    int twice(int value) {
+        return value * 2;
+    }
+
+    Result<int> chainResult(int value) {
+        return halveResult(value).map(increment).andThen(halveResult).map(twice);
+    }
+
+#if __cpp_lib_expected >= 202211L
+    std::expected<int, std::string> chainExpected(int value) {
+        return halveExpected(value).transform(increment).and_then(halveExpected).transform(twice);
+    }
+#endif
+
+    int chainCode(int value, int& out) {
+        int half;
+        if (int code = halveCode(value, half)) {
+            return code;
+        }
+        if (int code = halveCode(increment(half), out)) {
+            return code;
+        }
+        out = twice(out);
+        return 0;
+    }
+
+    int chainThrow(int value) {
+        return twice(halveThrow(increment(halveThrow(value))));
+    }
+}
+
+GEODE_BENCH("chain ok", "geode::Result") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += chainResult(opaque(int(i & 0xffff))).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+#if __cpp_lib_expected >= 202211L
+GEODE_BENCH("chain ok", "std::expected") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += chainExpected(opaque(int(i & 0xffff))).value_or(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("chain ok", "error code") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (chainCode(opaque(int(i & 0xffff)), value) == 0) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("chain ok", "exception") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        try {
+            sum += chainThrow(opaque(int(i & 0xffff)));
+        }
+        catch (std::invalid_argument const&) {}
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("chain err", "geode::Result") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += chainResult(opaque(-1)).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+#if __cpp_lib_expected >= 202211L
+GEODE_BENCH("chain err", "std::expected") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += chainExpected(opaque(-1)).value_or(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("chain err", "error code") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (chainCode(opaque(-1), value) == 0) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("chain err", "exception") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        try {
+            sum += chainThrow(opaque(-1));
+        }
+        catch (std::invalid_argument const&) {}
+    }
+    doNotOptimize(sum);
+}
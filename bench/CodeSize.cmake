@@ -0,0 +1,38 @@
+# Reports the size of the hot and cold text of each object in OBJECTS
+# along with the number of instructions in the hot text, using OBJDUMP
+
+if (NOT OBJDUMP)
+    message(FATAL_ERROR "GeodeResultCodeSize needs objdump")
+endif()
+
+foreach (object IN LISTS OBJECTS)
+    execute_process(
+        COMMAND ${OBJDUMP} -h ${object}
+        OUTPUT_VARIABLE headers
+        COMMAND_ERROR_IS_FATAL ANY
+    )
+    set(hot 0)
+    set(cold 0)
+    string(REPLACE "\n" ";" lines "${headers}")
+    foreach (line IN LISTS lines)
+        if (line MATCHES "^ *[0-9]+ +(\\.text[^ ]*) +([0-9a-f]+) ")
+            math(EXPR bytes "0x${CMAKE_MATCH_2}")
+            if (CMAKE_MATCH_1 MATCHES "unlikely|cold")
+                math(EXPR cold "${cold} + ${bytes}")
+            else()
+                math(EXPR hot "${hot} + ${bytes}")
+            endif()
+        endif()
+    endforeach()
+
+    execute_process(
+        COMMAND ${OBJDUMP} -d --no-show-raw-insn -j .text ${object}
+        OUTPUT_VARIABLE disassembly
+        COMMAND_ERROR_IS_FATAL ANY
+    )
+    string(REGEX MATCHALL "\n +[0-9a-f]+:\t" instructions "${disassembly}")
+    list(LENGTH instructions count)
+
+    get_filename_component(name ${object} NAME)
+    message(STATUS "${name}: ${hot} bytes hot text, ${cold} bytes cold text, ${count} instructions in .text")
+endforeach()
@@ -0,0 +1,184 @@
+// Construction, moves and unwrapping of a single value
+#include "Operations.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    // What an error code API would return when it has to carry a value
+    struct CodeResult {
+        int value;
+        int code;
+    };
+}
+
+GEODE_BENCH("construct ok", "geode::Result") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Result<int> res = Ok(opaque(int(i)));
+        doNotOptimize(res);
+    }
+}
+
+#if __cpp_lib_expected >= 202202L
+GEODE_BENCH("construct ok", "std::expected") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::expected<int, std::string> res = opaque(int(i));
+        doNotOptimize(res);
+    }
+}
+#endif
+
+GEODE_BENCH("construct ok", "error code") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        CodeResult res{opaque(int(i)), 0};
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("construct err", "geode::Result") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Result<int> res = Err(opaque(errorMessage));
+        doNotOptimize(res);
+    }
+}
+
+#if __cpp_lib_expected >= 202202L
+GEODE_BENCH("construct err", "std::expected") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::expected<int, std::string> res = std::unexpected(opaque(errorMessage));
+        doNotOptimize(res);
+    }
+}
+#endif
+
+GEODE_BENCH("construct err", "error code") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        CodeResult res{0, opaque(NegativeValue)};
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("construct err", "exception") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::invalid_argument error(opaque(errorMessage));
+        doNotOptimize(error);
+    }
+}
+
+GEODE_BENCH("move", "geode::Result") {
+    Result<std::string> first = Ok(std::string(errorMessage));
+    Result<std::string> second = Err(std::string(errorMessage));
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::swap(first, second);
+        doNotOptimize(first);
+    }
+}
+
+#if __cpp_lib_expected >= 202202L
+GEODE_BENCH("move", "std::expected") {
+    std::expected<std::string, std::string> first = std::string(errorMessage);
+    std::expected<std::string, std::string> second = std::unexpected(std::string(errorMessage));
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::swap(first, second);
+        doNotOptimize(first);
+    }
+}
+#endif
+
+GEODE_BENCH("move", "error code") {
+    std::pair<std::string, int> first{errorMessage, 0};
+    std::pair<std::string, int> second{errorMessage, NegativeValue};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::swap(first, second);
+        doNotOptimize(first);
+    }
+}
+
+GEODE_BENCH("unwrap", "geode::Result") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += halveResult(opaque(int(i & 0xffff))).unwrap();
+    }
+    doNotOptimize(sum);
+}
+
+#if __cpp_lib_expected >= 202202L
+GEODE_BENCH("unwrap", "std::expected") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += halveExpected(opaque(int(i & 0xffff))).value();
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("unwrap", "error code") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (halveCode(opaque(int(i & 0xffff)), value) != 0) {
+            std::abort();
+        }
+        sum += value;
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("unwrap", "exception") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += halveThrow(opaque(int(i & 0xffff)));
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("handle err", "geode::Result") {
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = halveResult(opaque(-1));
+        if (res.isErr()) {
+            length += res.unwrapErr().size();
+        }
+    }
+    doNotOptimize(length);
+}
+
+#if __cpp_lib_expected >= 202202L
+GEODE_BENCH("handle err", "std::expected") {
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = halveExpected(opaque(-1));
+        if (!res) {
+            length += res.error().size();
+        }
+    }
+    doNotOptimize(length);
+}
+#endif
+
+GEODE_BENCH("handle err", "error code") {
+    std::size_t failures = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (halveCode(opaque(-1), value) != 0) {
+            failures += 1;
+        }
+    }
+    doNotOptimize(failures);
+}
+
+GEODE_BENCH("handle err", "exception") {
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        try {
+            doNotOptimize(halveThrow(opaque(-1)));
+        }
+        catch (std::invalid_argument const& error) {
+            length += std::string_view(error.what()).size();
+        }
+    }
+    doNotOptimize(length);
+}
@@ -0,0 +1,102 @@
+// Adding context to an Err through 8 and 32 layers: mapErr with string
+// concatenation against Result::context, and how much reading the final message costs
+#include "Operations.hpp"
+
+#include <string>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    std::string addLayer(std::string error) {
+        return "while loading a layer: " + error;
+    }
+
+    GEODE_BENCH_NOINLINE Result<int> concatLayer(int value, int depth) {
+        if (depth == 1) {
+            return halveResult(value).mapErr(addLayer);
+        }
+        return concatLayer(value, depth - 1).mapErr(addLayer);
+    }
+
+    GEODE_BENCH_NOINLINE Result<int, ContextError> contextLayer(int value, int depth) {
+        if (depth == 1) {
+            return halveResult(value).context("while loading a layer");
+        }
+        return contextLayer(value, depth - 1).context("while loading a layer");
+    }
+}
+
+GEODE_BENCH("context 8 layers", "mapErr concatenation") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = concatLayer(opaque(-1), 8);
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("context 8 layers", "Result::context") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = contextLayer(opaque(-1), 8);
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("context 8 layers", "Result::context + message") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto message = contextLayer(opaque(-1), 8).unwrapErr().message();
+        doNotOptimize(message);
+    }
+}
+
+GEODE_BENCH("context 8 layers ok", "mapErr concatenation") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += concatLayer(opaque(int(i & 0xffff) * 2), 8).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("context 8 layers ok", "Result::context") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += contextLayer(opaque(int(i & 0xffff) * 2), 8).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("context 32 layers", "mapErr concatenation") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = concatLayer(opaque(-1), 32);
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("context 32 layers", "Result::context") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = contextLayer(opaque(-1), 32);
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("context 32 layers", "Result::context + message") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto message = contextLayer(opaque(-1), 32).unwrapErr().message();
+        doNotOptimize(message);
+    }
+}
+
+GEODE_BENCH("context 32 layers ok", "mapErr concatenation") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += concatLayer(opaque(int(i & 0xffff) * 2), 32).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("context 32 layers ok", "Result::context") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += contextLayer(opaque(int(i & 0xffff) * 2), 32).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
@@ -0,0 +1,78 @@
+// Frame cost of Result coroutines compared with GEODE_UNWRAP
+#include "Operations.hpp"
+
+#include <Geode/result/Coroutine.hpp>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    GEODE_BENCH_NOINLINE Result<int> quarterAwait(int value) {
+        int half = co_await halveResult(value);
+        co_return halveResult(half);
+    }
+
+    GEODE_BENCH_NOINLINE Result<int> quarterUnwrapInto(int value) {
+        GEODE_UNWRAP_INTO(int half, halveResult(value));
+        return halveResult(half);
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    GEODE_BENCH_NOINLINE Result<int> quarterUnwrap(int value) {
+        int half = GEODE_UNWRAP(halveResult(value));
+        return halveResult(half);
+    }
+#endif
+}
+
+GEODE_BENCH("coroutine ok", "co_await") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterAwait(opaque(int(i & 0xffff))).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+GEODE_BENCH("coroutine ok", "GEODE_UNWRAP") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterUnwrap(opaque(int(i & 0xffff))).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("coroutine ok", "GEODE_UNWRAP_INTO") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterUnwrapInto(opaque(int(i & 0xffff))).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("coroutine err", "co_await") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterAwait(opaque(-1)).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+GEODE_BENCH("coroutine err", "GEODE_UNWRAP") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterUnwrap(opaque(-1)).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("coroutine err", "GEODE_UNWRAP_INTO") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterUnwrapInto(opaque(-1)).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
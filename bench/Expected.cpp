@@ -0,0 +1,107 @@
+// Converting a Result to std::expected and back: toExpected and fromExpected
+// against unwrapping and re-wrapping by hand, with two plain moves of the
+// Result as the floor, since a round trip has to move the payload twice
+#include "Operations.hpp"
+
+#include <Geode/result/Expected.hpp>
+
+#include <utility>
+#include <vector>
+
+#if __cpp_lib_expected >= 202202L
+using namespace geode;
+using namespace bench;
+
+namespace {
+    // several heap owning members, so that every extra move shows
+    struct Record {
+        std::string name;
+        std::vector<int> values;
+        std::string note;
+    };
+
+    using RecordResult = Result<Record, std::string>;
+    using RecordExpected = std::expected<Record, std::string>;
+
+    RecordResult makeRecord() {
+        return Ok(Record{std::string(32, 'n'), std::vector<int>(8, 1), std::string(32, 'o')});
+    }
+
+    GEODE_BENCH_NOINLINE RecordExpected rewrapExpected(RecordResult&& res) {
+        if (res.isOk()) {
+            return RecordExpected(std::move(res).unwrap());
+        }
+        return std::unexpected(std::move(res).unwrapErr());
+    }
+
+    GEODE_BENCH_NOINLINE RecordResult rewrapResult(RecordExpected&& expected) {
+        if (expected.has_value()) {
+            return Ok(std::move(*expected));
+        }
+        return Err(std::move(expected).error());
+    }
+
+    GEODE_BENCH_NOINLINE RecordExpected bridgeExpected(RecordResult&& res) {
+        return toExpected(std::move(res));
+    }
+
+    GEODE_BENCH_NOINLINE RecordResult bridgeResult(RecordExpected&& expected) {
+        return fromExpected(std::move(expected));
+    }
+
+    GEODE_BENCH_NOINLINE RecordResult moveResult(RecordResult&& res) {
+        return std::move(res);
+    }
+}
+
+GEODE_BENCH("expected round trip", "two Result moves") {
+    auto res = makeRecord();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto moved = moveResult(std::move(res));
+        res = moveResult(std::move(moved));
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("expected round trip", "toExpected + fromExpected") {
+    auto res = makeRecord();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto expected = bridgeExpected(std::move(res));
+        res = bridgeResult(std::move(expected));
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("expected round trip", "unwrap and re-wrap") {
+    auto res = makeRecord();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto expected = rewrapExpected(std::move(res));
+        res = rewrapResult(std::move(expected));
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("expected unwrap", "Result") {
+    auto sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = [&]() -> Result<int> {
+            int value = GEODE_UNWRAP(halveResult(opaque(int(i & 0xffff) * 2)));
+            return Ok(value);
+        }();
+        sum += res.unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("expected unwrap", "std::expected") {
+    auto sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = [&]() -> Result<int> {
+            int value = GEODE_UNWRAP(halveExpected(opaque(int(i & 0xffff) * 2)));
+            return Ok(value);
+        }();
+        sum += res.unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
@@ -0,0 +1,318 @@
+// Every GEODE_UNWRAP* macro, next to the hand written code it replaces
+#include "Operations.hpp"
+
+#include <stdexcept>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    int input(std::size_t i) {
+        return opaque(int(i & 0xffff));
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    GEODE_BENCH_NOINLINE Result<int> quarterUnwrap(int value) {
+        auto half = GEODE_UNWRAP(halveResult(value));
+        return halveResult(half);
+    }
+#endif
+
+    GEODE_BENCH_NOINLINE Result<int> quarterUnwrapInto(int value) {
+        GEODE_UNWRAP_INTO(auto half, halveResult(value));
+        return halveResult(half);
+    }
+
+#if __cpp_lib_expected >= 202202L
+    GEODE_BENCH_NOINLINE std::expected<int, std::string> quarterExpected(int value) {
+        auto half = halveExpected(value);
+        if (!half) {
+            return std::unexpected(std::move(half).error());
+        }
+        return halveExpected(*half);
+    }
+#endif
+
+    GEODE_BENCH_NOINLINE int quarterCode(int value, int& out) {
+        int half;
+        if (int code = halveCode(value, half)) {
+            return code;
+        }
+        return halveCode(half, out);
+    }
+
+    GEODE_BENCH_NOINLINE int quarterThrow(int value) {
+        return halveThrow(halveThrow(value));
+    }
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+GEODE_BENCH("propagate ok", "GEODE_UNWRAP") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterUnwrap(input(i)).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("propagate ok", "GEODE_UNWRAP_INTO") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterUnwrapInto(input(i)).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+#if __cpp_lib_expected >= 202202L
+GEODE_BENCH("propagate ok", "std::expected") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterExpected(input(i)).value_or(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("propagate ok", "error code") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (quarterCode(input(i), value) == 0) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("propagate ok", "exception") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        try {
+            sum += quarterThrow(input(i));
+        }
+        catch (std::invalid_argument const&) {}
+    }
+    doNotOptimize(sum);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+GEODE_BENCH("propagate err", "GEODE_UNWRAP") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterUnwrap(opaque(-1)).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("propagate err", "GEODE_UNWRAP_INTO") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterUnwrapInto(opaque(-1)).unwrapOr(0);
+    }
+    doNotOptimize(sum);
+}
+
+#if __cpp_lib_expected >= 202202L
+GEODE_BENCH("propagate err", "std::expected") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += quarterExpected(opaque(-1)).value_or(0);
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("propagate err", "error code") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (quarterCode(opaque(-1), value) == 0) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("propagate err", "exception") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        try {
+            sum += quarterThrow(opaque(-1));
+        }
+        catch (std::invalid_argument const&) {}
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "GEODE_UNWRAP_IF_OK") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (GEODE_UNWRAP_IF_OK(value, halveResult(input(i)))) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "GEODE_UNWRAP_INTO_IF_OK") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (GEODE_UNWRAP_INTO_IF_OK(value, halveResult(input(i)))) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "GEODE_UNWRAP_IF_SOME") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (GEODE_UNWRAP_IF_SOME(value, halveResult(input(i)).ok())) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "GEODE_UNWRAP_INTO_IF_SOME") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (GEODE_UNWRAP_INTO_IF_SOME(value, halveResult(input(i)).ok())) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "GEODE_UNWRAP_OR_ELSE") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        GEODE_UNWRAP_OR_ELSE(value, err, halveResult(input(i))) {
+            continue;
+        }
+        sum += value;
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "GEODE_UNWRAP_INTO_OR_ELSE") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        GEODE_UNWRAP_INTO_OR_ELSE(value, err, halveResult(input(i))) {
+            continue;
+        }
+        sum += value;
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "GEODE_UNWRAP_EITHER") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (GEODE_UNWRAP_EITHER(value, err, halveResult(input(i)))) {
+            sum += value;
+        }
+        else {
+            sum -= int(err.size());
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "GEODE_UNWRAP_INTO_EITHER") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        std::string err;
+        if (GEODE_UNWRAP_INTO_EITHER(value, err, halveResult(input(i)))) {
+            sum += value;
+        }
+        else {
+            sum -= int(err.size());
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect ok", "isOk/unwrap") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = halveResult(input(i));
+        if (res.isOk()) {
+            sum += std::move(res).unwrap();
+        }
+    }
+    doNotOptimize(sum);
+}
+
+#if __cpp_lib_expected >= 202202L
+GEODE_BENCH("inspect ok", "std::expected") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (auto res = halveExpected(input(i))) {
+            sum += *res;
+        }
+    }
+    doNotOptimize(sum);
+}
+#endif
+
+GEODE_BENCH("inspect ok", "error code") {
+    int sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int value;
+        if (halveCode(input(i), value) == 0) {
+            sum += value;
+        }
+    }
+    doNotOptimize(sum);
+}
+
+GEODE_BENCH("inspect err", "GEODE_UNWRAP_IF_ERR") {
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (GEODE_UNWRAP_IF_ERR(err, halveResult(opaque(-1)))) {
+            length += err.size();
+        }
+    }
+    doNotOptimize(length);
+}
+
+GEODE_BENCH("inspect err", "GEODE_UNWRAP_INTO_IF_ERR") {
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::string err;
+        if (GEODE_UNWRAP_INTO_IF_ERR(err, halveResult(opaque(-1)))) {
+            length += err.size();
+        }
+    }
+    doNotOptimize(length);
+}
+
+GEODE_BENCH("inspect err", "GEODE_UNWRAP_OR_ELSE") {
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        GEODE_UNWRAP_OR_ELSE(value, err, halveResult(opaque(-1))) {
+            length += err.size();
+            continue;
+        }
+        length += value;
+    }
+    doNotOptimize(length);
+}
+
+GEODE_BENCH("inspect err", "isErr/unwrapErr") {
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = halveResult(opaque(-1));
+        if (res.isErr()) {
+            length += std::move(res).unwrapErr().size();
+        }
+    }
+    doNotOptimize(length);
+}
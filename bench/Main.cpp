@@ -0,0 +1,146 @@
+// A small self-contained benchmark runner: every registered benchmark is
+// calibrated to run for a few milliseconds, then measured several times and
+// reported with the fastest ns/op and the allocations made per operation.
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace {
+    std::atomic<std::size_t> g_allocations = 0;
+
+    constexpr auto CalibrationTarget = std::chrono::milliseconds(20);
+    constexpr int Repetitions = 5;
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+std::vector<bench::Case>& bench::cases() {
+    static std::vector<Case> cases;
+    return cases;
+}
+
+std::size_t bench::allocations() noexcept {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+namespace {
+    struct Measurement {
+        double nanoseconds;
+        double allocations;
+    };
+
+    Measurement measure(bench::Function function) {
+        using Clock = std::chrono::steady_clock;
+
+        std::size_t iterations = 1;
+        while (true) {
+            auto start = Clock::now();
+            function(iterations);
+            if (Clock::now() - start >= CalibrationTarget || iterations >= (std::size_t(1) << 32)) {
+                break;
+            }
+            iterations *= 2;
+        }
+
+        Measurement best{1e300, 0};
+        for (int i = 0; i < Repetitions; ++i) {
+            auto allocations = bench::allocations();
+            auto start = Clock::now();
+            function(iterations);
+            auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            allocations = bench::allocations() - allocations;
+
+            best.nanoseconds = std::min(best.nanoseconds, elapsed / iterations);
+            best.allocations = static_cast<double>(allocations) / iterations;
+        }
+        return best;
+    }
+
+    /// @brief Formats a CSV field, quoted as per RFC 4180 if it contains a
+    /// separator, a quote or a line break
+    std::string csvField(std::string_view field) {
+        if (field.find_first_of(",\"\r\n") == std::string_view::npos) {
+            return std::string(field);
+        }
+        std::string quoted = "\"";
+        for (auto c : field) {
+            if (c == '"') {
+                quoted += '"';
+            }
+            quoted += c;
+        }
+        quoted += '"';
+        return quoted;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string_view filter;
+    bool csv = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--csv") {
+            csv = true;
+        }
+        else if (arg == "--help" || arg == "-h") {
+            std::printf("usage: %s [--csv] [filter]\n", argv[0]);
+            return 0;
+        }
+        else {
+            filter = arg;
+        }
+    }
+
+    if (csv) {
+        std::printf("group,name,ns_per_op,allocations_per_op\n");
+    }
+    else {
+        std::printf("%-28s %-36s %10s %12s\n", "group", "name", "ns/op", "allocs/op");
+    }
+
+    std::string_view group;
+    for (auto const& entry : bench::cases()) {
+        std::string fullName = std::string(entry.group) + "/" + std::string(entry.name);
+        if (!filter.empty() && fullName.find(filter) == std::string::npos) {
+            continue;
+        }
+        auto result = measure(entry.function);
+        if (csv) {
+            std::printf(
+                "%s,%s,%.3f,%.3f\n", csvField(entry.group).c_str(), csvField(entry.name).c_str(),
+                result.nanoseconds, result.allocations
+            );
+        }
+        else {
+            if (entry.group != group && !group.empty()) {
+                std::printf("\n");
+            }
+            std::printf(
+                "%-28.*s %-36.*s %10.2f %12.2f\n", int(entry.group.size()), entry.group.data(),
+                int(entry.name.size()), entry.name.data(), result.nanoseconds, result.allocations
+            );
+        }
+        group = entry.group;
+        std::fflush(stdout);
+    }
+}
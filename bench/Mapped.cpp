@@ -0,0 +1,87 @@
+// Loading a 16 MB data file and scanning it once: reading it through an
+// ifstream into a Result<std::string> against mapping it with MappedFile,
+// which skips the read into a buffer and the copy
+#include "Bench.hpp"
+
+#include <Geode/result/Mapped.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#if defined(GEODE_RESULT_IMPL_POSIX)
+using namespace geode;
+using namespace bench;
+
+namespace {
+    struct DataFile {
+        char path[32] = "/tmp/geode-result-bench-XXXXXX";
+
+        DataFile() {
+            std::string line(63, 'x');
+            line += '\n';
+            std::string contents;
+            for (std::size_t i = 0; i < (16 << 20) / line.size(); ++i) {
+                contents += line;
+            }
+            int fd = ::mkstemp(path);
+            (void)sys::write(fd, contents.data(), contents.size());
+            (void)sys::close(fd);
+        }
+
+        ~DataFile() {
+            ::unlink(path);
+        }
+    };
+
+    DataFile const& dataFile() {
+        static DataFile file;
+        return file;
+    }
+
+    GEODE_BENCH_NOINLINE Result<std::string> readString(char const* path) {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream) {
+            return Err("Unable to open file");
+        }
+        std::ostringstream contents;
+        contents << stream.rdbuf();
+        return Ok(std::move(contents).str());
+    }
+
+    std::size_t countLines(std::string_view text) {
+        return static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n'));
+    }
+}
+
+GEODE_BENCH("load 16 MB file", "ifstream into std::string") {
+    auto path = dataFile().path;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto lines = readString(path).map([](std::string&& text) {
+            return countLines(text);
+        });
+        doNotOptimize(lines);
+    }
+}
+
+GEODE_BENCH("load 16 MB file", "MappedFile") {
+    auto path = dataFile().path;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto lines = MappedFile::open(path).map([](MappedFile&& file) {
+            return countLines(file.text());
+        });
+        doNotOptimize(lines);
+    }
+}
+
+GEODE_BENCH("load 16 MB file", "MappedFile, sequential") {
+    auto path = dataFile().path;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto lines = MappedFile::open(path, {.sequential = true}).map([](MappedFile&& file) {
+            return countLines(file.text());
+        });
+        doNotOptimize(lines);
+    }
+}
+#endif
@@ -0,0 +1,36 @@
+#include "Operations.hpp"
+
+#include <stdexcept>
+
+using namespace geode;
+
+Result<int> bench::halveResult(int value) {
+    if (value < 0) {
+        return Err(errorMessage);
+    }
+    return Ok(value / 2);
+}
+
+int bench::halveCode(int value, int& out) noexcept {
+    if (value < 0) {
+        return NegativeValue;
+    }
+    out = value / 2;
+    return 0;
+}
+
+int bench::halveThrow(int value) {
+    if (value < 0) {
+        throw std::invalid_argument(errorMessage);
+    }
+    return value / 2;
+}
+
+#if __cpp_lib_expected >= 202202L
+std::expected<int, std::string> bench::halveExpected(int value) {
+    if (value < 0) {
+        return std::unexpected(errorMessage);
+    }
+    return value / 2;
+}
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Bench.hpp"
+
+#include <string>
+
+#if __has_include(<expected>)
+    #include <expected>
+#endif
+
+// The same fallible operation written with each error handling approach:
+// halves a value, failing for negative values. They live in their own
+// translation unit so each benchmark pays for a real call and return.
+namespace bench {
+    /// @brief Error code returned by halveCode for negative values
+    inline constexpr int NegativeValue = 1;
+
+    GEODE_BENCH_NOINLINE geode::Result<int> halveResult(int value);
+
+    GEODE_BENCH_NOINLINE int halveCode(int value, int& out) noexcept;
+
+    GEODE_BENCH_NOINLINE int halveThrow(int value);
+
+#if __cpp_lib_expected >= 202202L
+    GEODE_BENCH_NOINLINE std::expected<int, std::string> halveExpected(int value);
+#endif
+}
@@ -0,0 +1,111 @@
+// parallel::tryTransform at several thread counts against a sequential loop
+#include "Operations.hpp"
+
+#include <Geode/result/Parallel.hpp>
+
+#include <cstdint>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    constexpr std::size_t BatchSize = 1 << 16;
+
+    Result<std::uint32_t> checksum(std::uint32_t value) {
+        // a few dozen nanoseconds of work per element
+        for (int i = 0; i < 16; ++i) {
+            value ^= value << 13;
+            value ^= value >> 17;
+            value ^= value << 5;
+        }
+        if (value == 0) {
+            return Err(errorMessage);
+        }
+        return Ok(value);
+    }
+
+    Result<std::uint32_t> validate(std::uint32_t value) {
+        return checksum(value).andThen([](std::uint32_t sum) -> Result<std::uint32_t> {
+            if (sum % 1000003 == 0) {
+                return Err(errorMessage);
+            }
+            return Ok(sum / 2);
+        });
+    }
+
+    std::vector<std::uint32_t> const& batch() {
+        static auto values = [] {
+            std::vector<std::uint32_t> values(BatchSize);
+            for (std::size_t i = 0; i < BatchSize; ++i) {
+                values[i] = static_cast<std::uint32_t>(i * 2654435761u) | 1;
+            }
+            return values;
+        }();
+        return values;
+    }
+
+    // the batch with an Err a tenth of the way in
+    std::vector<std::uint32_t> const& failingBatch() {
+        static auto values = [] {
+            auto values = batch();
+            values[BatchSize / 10] = 0;
+            return values;
+        }();
+        return values;
+    }
+
+    Result<std::vector<std::uint32_t>> sequential(std::vector<std::uint32_t> const& values) {
+        std::vector<std::uint32_t> out;
+        out.reserve(values.size());
+        for (auto value : values) {
+            GEODE_UNWRAP_INTO(auto checked, validate(value));
+            out.push_back(checked);
+        }
+        return Ok(std::move(out));
+    }
+
+    void runParallel(std::size_t iterations, std::vector<std::uint32_t> const& values, std::size_t threads) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto res = parallel::tryTransform(values, validate, {.threads = threads});
+            doNotOptimize(res);
+        }
+    }
+}
+
+GEODE_BENCH("tryTransform 64k ok", "sequential andThen") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = sequential(batch());
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("tryTransform 64k ok", "1 thread") {
+    runParallel(iterations, batch(), 1);
+}
+
+GEODE_BENCH("tryTransform 64k ok", "4 threads") {
+    runParallel(iterations, batch(), 4);
+}
+
+GEODE_BENCH("tryTransform 64k ok", "16 threads") {
+    runParallel(iterations, batch(), 16);
+}
+
+GEODE_BENCH("tryTransform 64k err", "sequential andThen") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = sequential(failingBatch());
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("tryTransform 64k err", "1 thread") {
+    runParallel(iterations, failingBatch(), 1);
+}
+
+GEODE_BENCH("tryTransform 64k err", "4 threads") {
+    runParallel(iterations, failingBatch(), 4);
+}
+
+GEODE_BENCH("tryTransform 64k err", "16 threads") {
+    runParallel(iterations, failingBatch(), 16);
+}
@@ -0,0 +1,122 @@
+// Handing Results between two threads: ResultSlot against a mutex and condition
+// variable around a std::optional, and against std::promise/std::future
+#include "Bench.hpp"
+
+#include <Geode/result/Slot.hpp>
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    enum class IoError {
+        Closed,
+    };
+
+    using Buffer = std::vector<char>;
+    using IoResult = Result<Buffer, IoError>;
+
+    // the producer sends a buffer it already owns, so moving it does not allocate
+    IoResult readBuffer(Buffer& source) {
+        return Ok(std::move(source));
+    }
+
+    class LockedSlot {
+    protected:
+        std::mutex m_mutex;
+        std::condition_variable m_changed;
+        std::optional<IoResult> m_value;
+
+    public:
+        void set(IoResult&& result) {
+            std::unique_lock lock(m_mutex);
+            m_changed.wait(lock, [&] { return !m_value; });
+            m_value.emplace(std::move(result));
+            m_changed.notify_one();
+        }
+
+        IoResult get() {
+            std::unique_lock lock(m_mutex);
+            m_changed.wait(lock, [&] { return m_value.has_value(); });
+            auto result = std::move(*m_value);
+            m_value.reset();
+            m_changed.notify_one();
+            return result;
+        }
+    };
+
+    // the consumer hands every buffer back, so the same few buffers go back and forth
+    template <class Send, class Receive, class SendBack, class ReceiveBack>
+    void pingPong(std::size_t iterations, Send send, Receive receive, SendBack sendBack, ReceiveBack receiveBack) {
+        std::jthread producer([&] {
+            Buffer buffer(4096);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                send(readBuffer(buffer));
+                buffer = receiveBack().unwrap();
+            }
+        });
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto result = receive();
+            doNotOptimize(result);
+            sendBack(std::move(result));
+        }
+    }
+}
+
+GEODE_BENCH("handoff same thread", "ResultSlot") {
+    ResultSlot<Buffer, IoError> slot;
+    Buffer buffer(4096);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        slot.set(readBuffer(buffer));
+        buffer = slot.get().unwrap();
+    }
+}
+
+GEODE_BENCH("handoff same thread", "mutex + condition variable") {
+    LockedSlot slot;
+    Buffer buffer(4096);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        slot.set(readBuffer(buffer));
+        buffer = slot.get().unwrap();
+    }
+}
+
+GEODE_BENCH("handoff same thread", "std::promise") {
+    Buffer buffer(4096);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::promise<IoResult> promise;
+        auto future = promise.get_future();
+        promise.set_value(readBuffer(buffer));
+        buffer = future.get().unwrap();
+    }
+}
+
+GEODE_BENCH("handoff round trip", "ResultSlot") {
+    ResultSlot<Buffer, IoError> there;
+    ResultSlot<Buffer, IoError> back;
+    pingPong(
+        iterations,
+        [&](IoResult&& result) { there.set(std::move(result)); },
+        [&] { return there.get(); },
+        [&](IoResult&& result) { back.set(std::move(result)); },
+        [&] { return back.get(); }
+    );
+}
+
+GEODE_BENCH("handoff round trip", "mutex + condition variable") {
+    LockedSlot there;
+    LockedSlot back;
+    pingPong(
+        iterations,
+        [&](IoResult&& result) { there.set(std::move(result)); },
+        [&] { return there.get(); },
+        [&](IoResult&& result) { back.set(std::move(result)); },
+        [&] { return back.get(); }
+    );
+}
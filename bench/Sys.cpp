@@ -0,0 +1,52 @@
+// Polling an empty non-blocking pipe, which fails with EAGAIN every time:
+// turning errno into a std::string with strerror against geode::Errno
+#include "Bench.hpp"
+
+#include <Geode/result/Sys.hpp>
+
+#if defined(GEODE_RESULT_IMPL_POSIX)
+using namespace geode;
+using namespace bench;
+
+namespace {
+    struct EmptyPipe {
+        int fds[2];
+
+        EmptyPipe() {
+            (void)::pipe(fds);
+            ::fcntl(fds[0], F_SETFL, O_NONBLOCK);
+        }
+
+        ~EmptyPipe() {
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+    };
+
+    GEODE_BENCH_NOINLINE Result<std::size_t, std::string> readString(int fd, void* buffer, std::size_t size) {
+        auto count = ::read(fd, buffer, size);
+        if (count == -1) {
+            return Err(std::string(std::strerror(errno)));
+        }
+        return Ok(static_cast<std::size_t>(count));
+    }
+}
+
+GEODE_BENCH("read EAGAIN", "std::string from strerror") {
+    EmptyPipe pipe;
+    char buffer[64];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = readString(pipe.fds[0], buffer, sizeof(buffer));
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("read EAGAIN", "geode::Errno") {
+    EmptyPipe pipe;
+    char buffer[64];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = sys::read(pipe.fds[0], buffer, sizeof(buffer));
+        doNotOptimize(res);
+    }
+}
+#endif
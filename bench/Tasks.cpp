@@ -0,0 +1,75 @@
+// Fanning out 8 tasks returning Results and joining them: whenAll on a
+// ThreadPool against a thread per task and std::async
+#include "Operations.hpp"
+
+#include <Geode/result/Tasks.hpp>
+
+#include <array>
+#include <future>
+#include <optional>
+#include <thread>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    constexpr int TaskCount = 8;
+
+    Result<int> task(int value) {
+        return halveResult(opaque(value * 2));
+    }
+
+    ThreadPool& pool() {
+        static ThreadPool pool(4);
+        return pool;
+    }
+}
+
+GEODE_BENCH("fan out 8", "whenAll ThreadPool") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = whenAll(
+            pool(),
+            [] { return task(0); }, [] { return task(1); }, [] { return task(2); }, [] { return task(3); },
+            [] { return task(4); }, [] { return task(5); }, [] { return task(6); }, [] { return task(7); }
+        );
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("fan out 8", "whenAll InlineExecutor") {
+    InlineExecutor executor;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = whenAll(
+            executor,
+            [] { return task(0); }, [] { return task(1); }, [] { return task(2); }, [] { return task(3); },
+            [] { return task(4); }, [] { return task(5); }, [] { return task(6); }, [] { return task(7); }
+        );
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("fan out 8", "thread per task") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::array<std::optional<Result<int>>, TaskCount> results;
+        {
+            std::array<std::jthread, TaskCount> threads;
+            for (int j = 0; j < TaskCount; ++j) {
+                threads[j] = std::jthread([&results, j] { results[j].emplace(task(j)); });
+            }
+        }
+        doNotOptimize(results);
+    }
+}
+
+GEODE_BENCH("fan out 8", "std::async") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::array<std::future<Result<int>>, TaskCount> futures;
+        for (int j = 0; j < TaskCount; ++j) {
+            futures[j] = std::async(std::launch::async, task, j);
+        }
+        for (auto& future : futures) {
+            auto res = future.get();
+            doNotOptimize(res);
+        }
+    }
+}
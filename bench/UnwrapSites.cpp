@@ -0,0 +1,67 @@
+// A corpus of unwrap call sites, built by the GeodeResultCodeSize target to
+// track how much code every inlined unwrap leaves behind in its caller.
+// Every site is a function of its own in the geode::unwrapSites namespace,
+// kept out of line and emitted even though nothing calls it.
+#include <Geode/Result.hpp>
+
+#include <cstdint>
+#include <string>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define GEODE_UNWRAP_SITE [[gnu::noinline, gnu::used]]
+#elif defined(_MSC_VER)
+    #define GEODE_UNWRAP_SITE __declspec(noinline)
+#else
+    #define GEODE_UNWRAP_SITE
+#endif
+
+#define GEODE_BENCH_SITES(Name, Type, Err)                                                                \
+    GEODE_UNWRAP_SITE Type Name##Owned(Result<Type, Err> res) {                                           \
+        return std::move(res).unwrap();                                                                   \
+    }                                                                                                     \
+    GEODE_UNWRAP_SITE Type Name##Ref(Result<Type, Err> const& res) {                                      \
+        return res.unwrap();                                                                              \
+    }                                                                                                     \
+    GEODE_UNWRAP_SITE Type Name##Sum(Result<Type, Err> const& a, Result<Type, Err> const& b) {            \
+        return a.unwrap() + b.unwrap();                                                                   \
+    }                                                                                                     \
+    GEODE_UNWRAP_SITE Err Name##ErrRef(Result<Type, Err> const& res) {                                    \
+        return res.unwrapErr();                                                                           \
+    }
+
+namespace geode::unwrapSites {
+    enum class Code : std::uint8_t {
+        Ok,
+        Invalid,
+        Overflow,
+    };
+
+    GEODE_BENCH_SITES(intString, int, std::string)
+    GEODE_BENCH_SITES(intCode, int, Code)
+    GEODE_BENCH_SITES(intInt, int, int)
+    GEODE_BENCH_SITES(sizeString, std::size_t, std::string)
+    GEODE_BENCH_SITES(doubleString, double, std::string)
+    GEODE_BENCH_SITES(floatCode, float, Code)
+    GEODE_BENCH_SITES(int64Int, std::int64_t, int)
+    GEODE_BENCH_SITES(charString, char, std::string)
+
+    GEODE_UNWRAP_SITE void voidString(Result<void, std::string>& res) {
+        res.unwrap();
+    }
+
+    GEODE_UNWRAP_SITE std::string stringString(Result<std::string, std::string> const& res) {
+        return res.unwrap();
+    }
+
+    GEODE_UNWRAP_SITE std::size_t lengthChain(Result<std::string, std::string> const& res) {
+        return res.map([](std::string const& value) { return value.size(); }).unwrap();
+    }
+
+    GEODE_UNWRAP_SITE int unwrapLoop(Result<int, std::string> const* results, std::size_t count) {
+        int sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += results[i].unwrap();
+        }
+        return sum;
+    }
+}
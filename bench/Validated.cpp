@@ -0,0 +1,98 @@
+// Validating a 20 field payload and reporting every invalid field: gathering
+// the errors into a std::vector by hand against combining Validateds, once
+// with every field valid and once with 3 invalid fields
+#include "Bench.hpp"
+
+#include <Geode/result/Validated.hpp>
+
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace geode;
+using namespace bench;
+
+namespace {
+    constexpr std::size_t FieldCount = 20;
+
+    struct Payload {
+        std::array<int, FieldCount> fields;
+    };
+
+    Payload makePayload(std::size_t invalid) {
+        Payload payload;
+        for (std::size_t i = 0; i < FieldCount; ++i) {
+            payload.fields[i] = i < invalid ? -1 : static_cast<int>(i);
+        }
+        return payload;
+    }
+
+    Validated<int> validateField(int value) {
+        if (value < 0) {
+            return Err("field is out of range");
+        }
+        return Ok(value);
+    }
+
+    GEODE_BENCH_NOINLINE Result<Payload, std::vector<std::string>> validateByHand(Payload const& payload) {
+        std::vector<std::string> errors;
+        Payload valid;
+        for (std::size_t i = 0; i < FieldCount; ++i) {
+            if (payload.fields[i] < 0) {
+                errors.push_back("field is out of range");
+            }
+            valid.fields[i] = payload.fields[i];
+        }
+        if (!errors.empty()) {
+            return Err(std::move(errors));
+        }
+        return Ok(valid);
+    }
+
+    template <std::size_t... Indices>
+    Validated<Payload> combineFields(Payload const& payload, std::index_sequence<Indices...>) {
+        return combine(
+            [](auto... fields) {
+                return Payload{{fields...}};
+            },
+            validateField(payload.fields[Indices])...
+        );
+    }
+
+    GEODE_BENCH_NOINLINE Validated<Payload> validateCombined(Payload const& payload) {
+        return combineFields(payload, std::make_index_sequence<FieldCount>());
+    }
+}
+
+GEODE_BENCH("validate 20 fields, valid", "std::vector by hand") {
+    auto payload = makePayload(0);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = validateByHand(opaque(&payload)[0]);
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("validate 20 fields, valid", "Validated combine") {
+    auto payload = makePayload(0);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = validateCombined(opaque(&payload)[0]);
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("validate 20 fields, 3 invalid", "std::vector by hand") {
+    auto payload = makePayload(3);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = validateByHand(opaque(&payload)[0]);
+        doNotOptimize(res);
+    }
+}
+
+GEODE_BENCH("validate 20 fields, 3 invalid", "Validated combine") {
+    auto payload = makePayload(3);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto res = validateCombined(opaque(&payload)[0]);
+        doNotOptimize(res);
+    }
+}
@@ -1,17 +1,23 @@
 #ifndef GEODE_RESULT_HPP
 #define GEODE_RESULT_HPP
 
+#include <atomic>
+#include <charconv>
 #include <concepts>
+#include <cstdint>
 #include <exception>
 #include <optional>
-#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
 #include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
 
 #if !defined(GEODE_CONCAT)
     #define GEODE_CONCAT2(x, y) x##y
@@ -22,25 +28,26 @@
     // Use gcc's scope expression feature, which makes this macro
     // really nice to use. Unfortunately not available on MSVC
     #if defined(__GNUC__) || defined(__clang__)
-        #define GEODE_UNWRAP_BASE(Return_, ...)                                            \
-            ({                                                                             \
-                auto GEODE_CONCAT(res, __LINE__) = __VA_ARGS__;                            \
-                if (GEODE_CONCAT(res, __LINE__).isErr())                                   \
-                    Return_ std::move(GEODE_CONCAT(res, __LINE__)).asErr();                \
-                std::move(GEODE_CONCAT(res, __LINE__)).unwrap();                           \
+        #define GEODE_UNWRAP_BASE(Return_, ...)                                               \
+            ({                                                                                \
+                auto GEODE_CONCAT(res, __LINE__) = __VA_ARGS__;                               \
+                if (::geode::impl::unwrapIsErr(GEODE_CONCAT(res, __LINE__)))                  \
+                    Return_ ::geode::impl::unwrapErr(std::move(GEODE_CONCAT(res, __LINE__))); \
+                ::geode::impl::unwrapOk(std::move(GEODE_CONCAT(res, __LINE__)));              \
             })
     #else
-        #define GEODE_UNWRAP_BASE(Return_, ...) \
-            if (auto res = __VA_ARGS__; res.isErr()) Return_ std::move(res).asErr()
+        #define GEODE_UNWRAP_BASE(Return_, ...)                          \
+            if (auto res = __VA_ARGS__; ::geode::impl::unwrapIsErr(res)) \
+                Return_ ::geode::impl::unwrapErr(std::move(res))
     #endif
 #endif
 
 #if !defined(GEODE_UNWRAP_INTO_BASE)
-    #define GEODE_UNWRAP_INTO_BASE(Return_, variable, ...)                         \
-        auto GEODE_CONCAT(res, __LINE__) = __VA_ARGS__;                            \
-        if (GEODE_CONCAT(res, __LINE__).isErr())                                   \
-            Return_ std::move(GEODE_CONCAT(res, __LINE__)).asErr();                \
-        variable = std::move(GEODE_CONCAT(res, __LINE__)).unwrap()
+    #define GEODE_UNWRAP_INTO_BASE(Return_, variable, ...)                            \
+        auto GEODE_CONCAT(res, __LINE__) = __VA_ARGS__;                               \
+        if (::geode::impl::unwrapIsErr(GEODE_CONCAT(res, __LINE__)))                  \
+            Return_ ::geode::impl::unwrapErr(std::move(GEODE_CONCAT(res, __LINE__))); \
+        variable = ::geode::impl::unwrapOk(std::move(GEODE_CONCAT(res, __LINE__)))
 #endif
 
 #if !defined(GEODE_UNWRAP)
@@ -146,6 +153,52 @@
             (errVariable = std::move(GEODE_CONCAT(res, __LINE__)).unwrapErr(), false)
 #endif
 
+// Formatting of the value in UnwrapException messages. Arithmetic, enum, pointer
+// and string-like values are always formatted. Define GEODE_RESULT_USE_FORMAT to
+// format anything supported by std::format, or GEODE_RESULT_STREAM_FALLBACK to
+// format anything that can be written to a std::ostream
+#if defined(GEODE_RESULT_USE_FORMAT) && __has_include(<format>)
+    #include <format>
+#endif
+
+#if defined(GEODE_RESULT_STREAM_FALLBACK)
+    #include <sstream>
+#endif
+
+#if !defined(GEODE_RESULT_DEFAULT_ERROR)
+    // The error type of a Result when none is given, define as geode::Error
+    // to use the lightweight error type instead
+    #define GEODE_RESULT_DEFAULT_ERROR std::string
+#endif
+
+#if !defined(GEODE_RESULT_REFERENCE_LITERALS)
+    // Whether geode::Error references string literals instead of copying them,
+    // which is only possible on 64 bit platforms. Define as 0 for the whole
+    // program to always copy them
+    #define GEODE_RESULT_REFERENCE_LITERALS 1
+#endif
+
+// Instrumentation of Err values. Define GEODE_RESULT_ON_ERR(location, error) to
+// have it called with the std::source_location and the stored value (a
+// std::monostate for void) of every place an Err(...) is converted into a
+// Result. Passing on the Err of another Result with asErr() or the GEODE_UNWRAP
+// macros is not reported. The built in hooks are GEODE_RESULT_INSTRUMENTATION,
+// which counts them per call site with Geode/result/Instrumentation.hpp, and
+// GEODE_RESULT_TRACING, which samples them into Geode/result/Trace.hpp. Any of
+// these must be defined for the whole program, and a custom hook must be
+// declared before this header
+#if defined(GEODE_RESULT_INSTRUMENTATION)
+    #include "result/Instrumentation.hpp"
+#endif
+
+#if defined(GEODE_RESULT_TRACING)
+    #include "result/Trace.hpp"
+#endif
+
+#if !defined(GEODE_RESULT_ON_ERR) && (defined(GEODE_RESULT_INSTRUMENTATION) || defined(GEODE_RESULT_TRACING))
+    #define GEODE_RESULT_ON_ERR(location, error) ::geode::impl::reportErr(location, error)
+#endif
+
 // Internal macros
 
 #if !defined(GEODE_RESULT_IMPL_THROW)
@@ -157,6 +210,33 @@
     #endif
 #endif
 
+#if !defined(GEODE_RESULT_IMPL_COLD)
+    #if defined(__GNUC__) || defined(__clang__)
+        #define GEODE_RESULT_IMPL_COLD [[gnu::cold, gnu::noinline]]
+    #elif defined(_MSC_VER)
+        #define GEODE_RESULT_IMPL_COLD __declspec(noinline)
+    #else
+        #define GEODE_RESULT_IMPL_COLD
+    #endif
+#endif
+
+#if defined(GEODE_RESULT_ON_ERR)
+    #include <source_location>
+
+    // Extra parameter of the constructors converting an Err into a Result, which
+    // captures the location of the conversion
+    #define GEODE_RESULT_IMPL_ERR_SITE , std::source_location site = std::source_location::current()
+    #define GEODE_RESULT_IMPL_REPORT_ERR(err)                                   \
+        if (!std::is_constant_evaluated() && !(err).m_propagated) {             \
+            GEODE_RESULT_ON_ERR(site, std::as_const(this->m_data).err());       \
+        }
+    #define GEODE_RESULT_IMPL_PROPAGATED(...) ::geode::impl::propagatedErr(__VA_ARGS__)
+#else
+    #define GEODE_RESULT_IMPL_ERR_SITE
+    #define GEODE_RESULT_IMPL_REPORT_ERR(err)
+    #define GEODE_RESULT_IMPL_PROPAGATED(...) __VA_ARGS__
+#endif
+
 namespace geode {
     template <class OkType, class ErrType>
     class Result;
@@ -261,6 +341,10 @@ namespace geode {
         class ErrContainer final {
         protected:
             ErrType m_err;
+#if defined(GEODE_RESULT_ON_ERR)
+            // set when the Err is passed on from another Result instead of being new
+            bool m_propagated = false;
+#endif
 
             constexpr explicit ErrContainer(ErrType&& err
             ) noexcept(std::is_nothrow_move_constructible_v<ErrType>) : m_err(std::move(err)) {}
@@ -283,6 +367,14 @@ namespace geode {
 
             friend constexpr impl::ErrContainer<ErrType> geode::Err<ErrType>(ErrType&& err);
 
+#if defined(GEODE_RESULT_ON_ERR)
+            template <class Container>
+            friend constexpr Container propagatedErr(Container&& container) noexcept;
+
+            template <class OkType2, class ErrType2>
+            friend class ResultDataWrapper;
+#endif
+
             template <class OkType2, class ErrType2>
             friend class geode::Result;
         };
@@ -291,6 +383,10 @@ namespace geode {
         class ErrContainer<ErrType&> final {
         protected:
             ErrType& m_err;
+#if defined(GEODE_RESULT_ON_ERR)
+            // set when the Err is passed on from another Result instead of being new
+            bool m_propagated = false;
+#endif
 
             constexpr explicit ErrContainer(ErrType& err) noexcept : m_err(err) {}
 
@@ -305,6 +401,14 @@ namespace geode {
 
             friend constexpr impl::ErrContainer<ErrType&> geode::Err<ErrType>(ErrType& err);
 
+#if defined(GEODE_RESULT_ON_ERR)
+            template <class Container>
+            friend constexpr Container propagatedErr(Container&& container) noexcept;
+
+            template <class OkType2, class ErrType2>
+            friend class ResultDataWrapper;
+#endif
+
             template <class OkType2, class ErrType2>
             friend class geode::Result;
         };
@@ -313,15 +417,51 @@ namespace geode {
         class ErrContainer<void> final {
         protected:
             std::monostate m_err;
+#if defined(GEODE_RESULT_ON_ERR)
+            // set when the Err is passed on from another Result instead of being new
+            bool m_propagated = false;
+#endif
 
             constexpr explicit ErrContainer() {}
 
             friend constexpr impl::ErrContainer<void> geode::Err();
 
+#if defined(GEODE_RESULT_ON_ERR)
+            template <class Container>
+            friend constexpr Container propagatedErr(Container&& container) noexcept;
+
+            template <class OkType2, class ErrType2>
+            friend class ResultDataWrapper;
+#endif
+
             template <class OkType2, class ErrType2>
             friend class geode::Result;
         };
 
+#if defined(GEODE_RESULT_ON_ERR)
+        /// @brief Marks an Err as passed on from another Result, so that converting
+        /// it into a Result is not reported to GEODE_RESULT_ON_ERR
+        template <class Container>
+        constexpr Container propagatedErr(Container&& container) noexcept {
+            container.m_propagated = true;
+            return std::move(container);
+        }
+
+    #if defined(GEODE_RESULT_INSTRUMENTATION) || defined(GEODE_RESULT_TRACING)
+        /// @brief The GEODE_RESULT_ON_ERR hook used by the built in instrumentation
+        template <class ErrType>
+        void reportErr(std::source_location const& location, ErrType const& error) noexcept {
+        #if defined(GEODE_RESULT_INSTRUMENTATION)
+            instrumentation::recordErr(location);
+        #endif
+        #if defined(GEODE_RESULT_TRACING)
+            tracing::recordErr(location, error);
+        #endif
+            (void)error;
+        }
+    #endif
+#endif
+
         template <class Type>
         struct IsOptionalImpl : std::false_type {
             using type = void;
@@ -356,17 +496,131 @@ namespace geode {
         template <class Type>
         using ResultErrType = typename IsResultImpl<Type>::ErrType;
 
+        // What GEODE_UNWRAP and GEODE_UNWRAP_INTO call on the value they are given,
+        // overloaded by companion headers to accept other result types
+        template <class Type>
+        constexpr bool unwrapIsErr(Type const& result) {
+            return result.isErr();
+        }
+
+        template <class Type>
+        constexpr decltype(auto) unwrapErr(Type&& result) {
+            return std::forward<Type>(result).asErr();
+        }
+
+        template <class Type>
+        constexpr decltype(auto) unwrapOk(Type&& result) {
+            return std::forward<Type>(result).unwrap();
+        }
+
         struct OkTag {};
 
         struct ErrTag {};
 
+#if defined(GEODE_RESULT_STREAM_FALLBACK)
         template <class Type>
         concept IsStringStreamable = requires(std::stringstream ss, Type t) { ss << t; };
+#endif
+
+        template <class Type>
+        concept IsUnwrapFormattable = std::convertible_to<Type const&, std::string_view> ||
+            std::convertible_to<Type const&, std::string> || std::is_arithmetic_v<Type> || std::is_enum_v<Type> || std::is_pointer_v<Type>
+#if defined(GEODE_RESULT_USE_FORMAT) && defined(__cpp_lib_format)
+            || requires(Type const& value) { std::format("{}", value); }
+#endif
+#if defined(GEODE_RESULT_STREAM_FALLBACK)
+            || IsStringStreamable<Type const&>
+#endif
+            ;
+
+        /// @brief Appends a value to an UnwrapException message, without going through streams
+        template <class Type>
+            requires IsUnwrapFormattable<Type>
+        void formatUnwrapValue(std::string& message, Type const& value) {
+            if constexpr (std::convertible_to<Type const&, std::string_view>) {
+                message += std::string_view(value);
+            }
+            else if constexpr (std::convertible_to<Type const&, std::string>) {
+                message += std::string(value);
+            }
+            else if constexpr (std::same_as<Type, char>) {
+                message += value;
+            }
+            else if constexpr (std::is_arithmetic_v<Type>) {
+                char buffer[64];
+                std::to_chars_result result;
+                if constexpr (std::same_as<Type, bool>) {
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<int>(value));
+                }
+                else if constexpr (std::is_floating_point_v<Type>) {
+                    // same as the default precision of streams
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6);
+                }
+                else {
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                }
+                message.append(buffer, result.ptr);
+            }
+            else if constexpr (std::is_enum_v<Type>) {
+                formatUnwrapValue(message, static_cast<std::underlying_type_t<Type>>(value));
+            }
+            else if constexpr (std::is_pointer_v<Type>) {
+                char buffer[2 * sizeof(std::uintptr_t)];
+                auto result = std::to_chars(
+                    buffer, buffer + sizeof(buffer), reinterpret_cast<std::uintptr_t>(value), 16
+                );
+                message += "0x";
+                message.append(buffer, result.ptr);
+            }
+#if defined(GEODE_RESULT_USE_FORMAT) && defined(__cpp_lib_format)
+            else if constexpr (requires { std::format("{}", value); }) {
+                std::format_to(std::back_inserter(message), "{}", value);
+            }
+#endif
+#if defined(GEODE_RESULT_STREAM_FALLBACK)
+            else {
+                message += (std::stringstream{} << value).str();
+            }
+#endif
+        }
+
+        template <class Type>
+        std::string unwrapMessage(std::string_view prefix, Type const& value) {
+            std::string message(prefix);
+            if constexpr (IsUnwrapFormattable<Type>) {
+                message += ": ";
+                formatUnwrapValue(message, value);
+            }
+            return message;
+        }
     }
 
     template <class Type>
     concept IsResult = impl::IsResultImpl<Type>::value;
 
+    /// @brief Customization point that lets a Result whose other side is void store
+    /// its state inside of an invalid value of Type, instead of a separate flag
+    /// @note Specializations provide a static constexpr value() function returning
+    /// the invalid value. Type has to be trivially copyable, and the value must never
+    /// be used as an actual Ok or Err value, as it would be read back as the other side
+    template <class Type>
+    struct ResultNiche {};
+
+    /// @brief Helper for declaring a constant as the niche of its type
+    /// @example template <> struct geode::ResultNiche<Handle*> : geode::ResultNicheValue<(Handle*)nullptr> {};
+    template <auto Value>
+    struct ResultNicheValue {
+        static constexpr decltype(Value) value() noexcept {
+            return Value;
+        }
+    };
+
+    template <class Type>
+    concept HasResultNiche = std::is_trivially_copyable_v<Type> && std::equality_comparable<Type> &&
+        requires {
+            { ResultNiche<Type>::value() } -> std::same_as<Type>;
+        };
+
     /// @brief Constructs a new Ok value
     /// @param ok the value to wrap in an Ok
     /// @return a new Ok value
@@ -411,31 +665,453 @@ namespace geode {
         return impl::ErrContainer<void>();
     }
 
-    class UnwrapException : public std::runtime_error {
+    namespace impl {
+        /// @brief The memory resource geode::Error and geode::ContextError allocate
+        /// from on the current thread, the global allocator when null
+        inline std::pmr::memory_resource*& errorResource() noexcept {
+            static thread_local constinit std::pmr::memory_resource* resource = nullptr;
+            return resource;
+        }
+
+        inline void* allocateError(std::pmr::memory_resource* resource, std::size_t size, std::size_t alignment) {
+            return resource ? resource->allocate(size, alignment) : ::operator new(size);
+        }
+
+        inline void deallocateError(std::pmr::memory_resource* resource, void* ptr, std::size_t size, std::size_t alignment) noexcept {
+            if (resource) {
+                resource->deallocate(ptr, size, alignment);
+            }
+            else {
+                ::operator delete(ptr, size);
+            }
+        }
+    }
+
+    /// @brief A lightweight error message, the size of a pointer
+    /// @note String literals are referenced without allocating, any other message
+    /// is copied once into a reference counted buffer that is shared between copies
+    class Error final {
+    protected:
+        struct Buffer {
+            std::atomic<std::size_t> refs;
+            std::size_t size;
+            // where the buffer was allocated from, null for the global allocator
+            std::pmr::memory_resource* resource;
+
+            char* data() noexcept {
+                return reinterpret_cast<char*>(this + 1);
+            }
+        };
+
+        // Literals are only referenced on 64 bit platforms, where user space addresses
+        // never have the top bit set, leaving it free to mark owned buffers
+        static constexpr bool CanReferenceLiterals = GEODE_RESULT_REFERENCE_LITERALS && sizeof(std::uintptr_t) == 8;
+        static constexpr std::uintptr_t OwnedTag = std::uintptr_t(1) << (sizeof(std::uintptr_t) * 8 - 1);
+
+        // 0 for an empty message, otherwise either a literal or a tagged Buffer
+        std::uintptr_t m_data = 0;
+
+        bool isOwned() const noexcept {
+            return m_data != 0 && (!CanReferenceLiterals || (m_data & OwnedTag));
+        }
+
+        Buffer* buffer() const noexcept {
+            if constexpr (CanReferenceLiterals) {
+                return reinterpret_cast<Buffer*>(m_data << 1);
+            }
+            else {
+                return reinterpret_cast<Buffer*>(m_data);
+            }
+        }
+
+        void assign(std::string_view message, std::pmr::memory_resource* resource = impl::errorResource()) {
+            if (message.empty()) {
+                m_data = 0;
+                return;
+            }
+            auto memory = impl::allocateError(resource, sizeof(Buffer) + message.size() + 1, alignof(Buffer));
+            auto buffer = ::new (memory) Buffer{{1}, message.size(), resource};
+            message.copy(buffer->data(), message.size());
+            buffer->data()[message.size()] = '\0';
+            if constexpr (CanReferenceLiterals) {
+                m_data = (reinterpret_cast<std::uintptr_t>(buffer) >> 1) | OwnedTag;
+            }
+            else {
+                m_data = reinterpret_cast<std::uintptr_t>(buffer);
+            }
+        }
+
+        void retain() const noexcept {
+            if (this->isOwned()) {
+                this->buffer()->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void release() noexcept {
+            if (this->isOwned()) {
+                auto buffer = this->buffer();
+                if (buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    auto resource = buffer->resource;
+                    auto size = sizeof(Buffer) + buffer->size + 1;
+                    buffer->~Buffer();
+                    impl::deallocateError(resource, buffer, size, alignof(Buffer));
+                }
+            }
+            m_data = 0;
+        }
+
     public:
-        template <class T>
-            requires(impl::IsStringStreamable<T>)
-        UnwrapException(impl::ErrTag, T&& err) :
-            std::runtime_error(
-                (std::stringstream{} << "Called unwrap on an Err Result: " << std::forward<T>(err)).str()
-            ) {}
+        /// @brief Constructs an empty error message
+        constexpr Error() noexcept = default;
 
-        template <class T>
-            requires(!impl::IsStringStreamable<T>)
-        UnwrapException(impl::ErrTag, T&& err) :
-            std::runtime_error("Called unwrap on an Err Result") {}
+        /// @brief Constructs an error message referencing a string literal
+        /// @param literal the string literal, which must outlive the Error
+        template <std::size_t Size>
+        Error(char const (&literal)[Size]) {
+            auto terminated = literal[Size - 1] == '\0';
+            if (CanReferenceLiterals && terminated) {
+                m_data = Size > 1 ? reinterpret_cast<std::uintptr_t>(+literal) : 0;
+            }
+            else {
+                // the null terminator of a literal is not part of the message
+                this->assign(std::string_view(literal, terminated ? Size - 1 : Size));
+            }
+        }
+
+        /// @brief Constructs an error message by copying a mutable buffer
+        /// @param buffer the null terminated buffer
+        template <std::size_t Size>
+        Error(char (&buffer)[Size]) {
+            this->assign(std::string_view(buffer));
+        }
+
+        /// @brief Constructs an error message by copying a string
+        /// @param message the string to copy
+        template <class String>
+            requires(!std::is_array_v<std::remove_cvref_t<String>> && !std::same_as<std::remove_cvref_t<String>, Error> && std::convertible_to<String, std::string_view>)
+        Error(String&& message) {
+            this->assign(std::string_view(message));
+        }
+
+        /// @brief Constructs an error message by copying a string into memory from a resource
+        /// @param message the string to copy
+        /// @param resource the memory resource, which must outlive every copy of the Error
+        Error(std::string_view message, std::pmr::memory_resource* resource) {
+            this->assign(message, resource);
+        }
+
+        Error(Error const& other) noexcept : m_data(other.m_data) {
+            this->retain();
+        }
+
+        Error(Error&& other) noexcept : m_data(std::exchange(other.m_data, 0)) {}
+
+        Error& operator=(Error const& other) noexcept {
+            other.retain();
+            this->release();
+            m_data = other.m_data;
+            return *this;
+        }
+
+        Error& operator=(Error&& other) noexcept {
+            if (this != &other) {
+                this->release();
+                m_data = std::exchange(other.m_data, 0);
+            }
+            return *this;
+        }
+
+        ~Error() {
+            this->release();
+        }
+
+        /// @brief Returns the error message
+        /// @return a view to the error message, valid as long as the Error
+        std::string_view message() const noexcept {
+            if (m_data == 0) {
+                return std::string_view();
+            }
+            if (this->isOwned()) {
+                auto buffer = this->buffer();
+                return std::string_view(buffer->data(), buffer->size);
+            }
+            return std::string_view(reinterpret_cast<char const*>(m_data));
+        }
+
+        operator std::string_view() const noexcept {
+            return this->message();
+        }
+
+        operator std::string() const {
+            return std::string(this->message());
+        }
+
+        friend bool operator==(Error const& error, std::string_view other) noexcept {
+            return error.message() == other;
+        }
+
+        template <class Stream>
+            requires requires(Stream& stream, std::string_view message) { stream << message; }
+        friend Stream& operator<<(Stream& stream, Error const& error) {
+            stream << error.message();
+            return stream;
+        }
+    };
+
+    /// @brief An error along with frames of context added while it propagates,
+    /// rendered as "outermost: ...: innermost: root" only when the message is read
+    /// @note Adding a frame never copies the others. The first InlineFrames frames
+    /// are stored in the object and deeper ones in linked chunks of ChunkFrames, and
+    /// frames are geode::Errors, so string literals are referenced without allocating
+    class ContextError final {
+    public:
+        static constexpr std::size_t InlineFrames = 4;
+        static constexpr std::size_t ChunkFrames = 8;
+
+    protected:
+        struct Chunk {
+            Error frames[ChunkFrames];
+            Chunk* next = nullptr;
+            // where the chunk was allocated from, null for the global allocator
+            std::pmr::memory_resource* resource = nullptr;
+        };
+
+        static Chunk* allocateChunk() {
+            auto resource = impl::errorResource();
+            auto chunk = ::new (impl::allocateError(resource, sizeof(Chunk), alignof(Chunk))) Chunk();
+            chunk->resource = resource;
+            return chunk;
+        }
+
+        static void freeChunk(Chunk* chunk) noexcept {
+            auto resource = chunk->resource;
+            chunk->~Chunk();
+            impl::deallocateError(resource, chunk, sizeof(Chunk), alignof(Chunk));
+        }
+
+        Error m_root;
+        Error m_frames[InlineFrames];
+        std::size_t m_depth = 0;
+        // frames past InlineFrames, the chunk with the most recent ones first
+        Chunk* m_overflow = nullptr;
+
+        std::size_t overflowed() const noexcept {
+            return m_depth > InlineFrames ? m_depth - InlineFrames : 0;
+        }
+
+        // number of frames in the first chunk, every other chunk is full
+        std::size_t newestChunkSize() const noexcept {
+            return (this->overflowed() - 1) % ChunkFrames + 1;
+        }
+
+        void clearOverflow() noexcept {
+            while (m_overflow) {
+                freeChunk(std::exchange(m_overflow, m_overflow->next));
+            }
+        }
+
+        void copyFrom(ContextError const& other) {
+            m_root = other.m_root;
+            for (std::size_t i = 0; i < InlineFrames; ++i) {
+                m_frames[i] = other.m_frames[i];
+            }
+            auto tail = &m_overflow;
+            for (auto chunk = other.m_overflow; chunk; chunk = chunk->next) {
+                *tail = allocateChunk();
+                for (std::size_t i = 0; i < ChunkFrames; ++i) {
+                    (*tail)->frames[i] = chunk->frames[i];
+                }
+                tail = &(*tail)->next;
+            }
+            m_depth = other.m_depth;
+        }
+
+        /// @brief Calls operation with every frame, from the outermost in
+        template <class Operation>
+        void forEachFrame(Operation&& operation) const {
+            if (m_overflow) {
+                for (auto i = this->newestChunkSize(); i > 0; --i) {
+                    operation(m_overflow->frames[i - 1].message());
+                }
+                for (auto chunk = m_overflow->next; chunk; chunk = chunk->next) {
+                    for (auto i = ChunkFrames; i > 0; --i) {
+                        operation(chunk->frames[i - 1].message());
+                    }
+                }
+            }
+            for (auto i = m_depth < InlineFrames ? m_depth : InlineFrames; i > 0; --i) {
+                operation(m_frames[i - 1].message());
+            }
+        }
+
+        void moveFrom(ContextError& other) noexcept {
+            m_root = std::move(other.m_root);
+            for (std::size_t i = 0; i < InlineFrames; ++i) {
+                m_frames[i] = std::move(other.m_frames[i]);
+            }
+            m_overflow = std::exchange(other.m_overflow, nullptr);
+            m_depth = std::exchange(other.m_depth, 0);
+        }
+
+    public:
+        /// @brief Constructs an empty error without context
+        ContextError() noexcept = default;
+
+        /// @brief Constructs an error without context
+        /// @param root anything geode::Error can be constructed from
+        template <class Root>
+            requires(!std::same_as<std::remove_cvref_t<Root>, ContextError> && std::constructible_from<Error, Root>)
+        ContextError(Root&& root) : m_root(std::forward<Root>(root)) {}
+
+        // delegating makes the destructor free the copied frames if copying throws
+        ContextError(ContextError const& other) : ContextError() {
+            this->copyFrom(other);
+        }
+
+        ContextError(ContextError&& other) noexcept {
+            this->moveFrom(other);
+        }
+
+        // copying first leaves the error untouched if allocating a chunk throws
+        ContextError& operator=(ContextError const& other) {
+            if (this != &other) {
+                ContextError copy(other);
+                *this = std::move(copy);
+            }
+            return *this;
+        }
+
+        ContextError& operator=(ContextError&& other) noexcept {
+            if (this != &other) {
+                this->clearOverflow();
+                this->moveFrom(other);
+            }
+            return *this;
+        }
+
+        ~ContextError() {
+            this->clearOverflow();
+        }
+
+        /// @brief Adds a frame of context around the error
+        /// @param frame what was being done, anything geode::Error can be constructed from
+        /// @return the error itself
+        template <class Frame>
+            requires std::constructible_from<Error, Frame>
+        ContextError& context(Frame&& frame) & {
+            if (m_depth < InlineFrames) {
+                m_frames[m_depth] = Error(std::forward<Frame>(frame));
+            }
+            else {
+                auto index = (m_depth - InlineFrames) % ChunkFrames;
+                if (index == 0) {
+                    auto chunk = allocateChunk();
+                    chunk->next = m_overflow;
+                    m_overflow = chunk;
+                }
+                m_overflow->frames[index] = Error(std::forward<Frame>(frame));
+            }
+            ++m_depth;
+            return *this;
+        }
+
+        /// @brief Adds a frame of context around the error
+        /// @param frame what was being done, anything geode::Error can be constructed from
+        /// @return the error itself
+        template <class Frame>
+            requires std::constructible_from<Error, Frame>
+        ContextError&& context(Frame&& frame) && {
+            return std::move(this->context(std::forward<Frame>(frame)));
+        }
+
+        /// @brief Returns the error the context was added to
+        Error const& root() const noexcept {
+            return m_root;
+        }
+
+        /// @brief Returns the number of frames of context
+        std::size_t depth() const noexcept {
+            return m_depth;
+        }
+
+        /// @brief Returns a frame of context, 0 being the outermost one
+        std::string_view frame(std::size_t index) const noexcept {
+            if (index < this->overflowed()) {
+                auto chunk = m_overflow;
+                auto size = this->newestChunkSize();
+                while (index >= size) {
+                    index -= size;
+                    chunk = chunk->next;
+                    size = ChunkFrames;
+                }
+                return chunk->frames[size - 1 - index].message();
+            }
+            return m_frames[m_depth - 1 - index].message();
+        }
+
+        /// @brief Renders the frames of context and the root error
+        /// @return every frame from the outermost in, followed by the root error,
+        /// separated by ": "
+        std::string message() const {
+            auto size = m_root.message().size();
+            this->forEachFrame([&](std::string_view frame) {
+                size += frame.size() + 2;
+            });
+            std::string message;
+            message.reserve(size);
+            this->forEachFrame([&](std::string_view frame) {
+                message += frame;
+                message += ": ";
+            });
+            message += m_root.message();
+            return message;
+        }
+
+        operator std::string() const {
+            return this->message();
+        }
+
+        friend bool operator==(ContextError const& error, std::string_view other) {
+            return error.message() == other;
+        }
+
+        template <class Stream>
+            requires requires(Stream& stream, std::string_view message) { stream << message; }
+        friend Stream& operator<<(Stream& stream, ContextError const& error) {
+            error.forEachFrame([&](std::string_view frame) {
+                stream << frame << std::string_view(": ");
+            });
+            stream << error.m_root.message();
+            return stream;
+        }
+    };
+
+    namespace impl {
+        /// @brief A frame of context, or an operation returning one
+        template <class Context>
+        concept ErrorContext = std::constructible_from<Error, Context> ||
+            (std::invocable<Context> && std::constructible_from<Error, std::invoke_result_t<Context>>);
+
+        template <class Context>
+        decltype(auto) contextFrame(Context&& context) {
+            if constexpr (std::constructible_from<Error, Context>) {
+                return std::forward<Context>(context);
+            }
+            else {
+                return std::invoke(std::forward<Context>(context));
+            }
+        }
+    }
 
+    class UnwrapException : public std::runtime_error {
+    public:
         template <class T>
-            requires(impl::IsStringStreamable<T>)
-        UnwrapException(impl::OkTag, T&& ok) :
-            std::runtime_error(
-                (std::stringstream{} << "Called unwrapErr on an Ok Result: " << std::forward<T>(ok)).str()
-            ) {}
+        UnwrapException(impl::ErrTag, T const& err) :
+            std::runtime_error(impl::unwrapMessage("Called unwrap on an Err Result", err)) {}
 
         template <class T>
-            requires(!impl::IsStringStreamable<T>)
-        UnwrapException(impl::OkTag, T&& ok) :
-            std::runtime_error("Called unwrapErr on an Ok Result") {}
+        UnwrapException(impl::OkTag, T const& ok) :
+            std::runtime_error(impl::unwrapMessage("Called unwrapErr on an Ok Result", ok)) {}
 
         UnwrapException(UnwrapException const&) = default;
         UnwrapException(UnwrapException&&) = default;
@@ -446,103 +1122,473 @@ namespace geode {
     };
 
     namespace impl {
+        /// @brief Throws the UnwrapException for a failed unwrap, kept out of line
+        /// so that inlined unwrap calls only carry a branch and a call
+        template <class Tag, class T>
+        [[noreturn]] GEODE_RESULT_IMPL_COLD void unwrapFailed(Tag tag, T const& value) {
+            GEODE_RESULT_IMPL_THROW(UnwrapException(tag, value));
+        }
+    }
+
+    namespace impl {
+        /// @brief Describes how a side of a Result is stored inside of ResultStorage
+        template <class Type>
+        struct ResultStorageTraits {
+            using Stored = Type;
+
+            template <class Arg>
+            static constexpr Arg&& store(Arg&& arg) noexcept {
+                return std::forward<Arg>(arg);
+            }
+
+            static constexpr Type& get(Stored& stored) noexcept {
+                return stored;
+            }
+
+            static constexpr Type const& get(Stored const& stored) noexcept {
+                return stored;
+            }
+
+            static constexpr Type&& get(Stored&& stored) noexcept {
+                return std::move(stored);
+            }
+        };
+
+        // References are stored as pointers, which keeps them trivial and lets
+        // the storage rebind them on assignment
+        template <class Type>
+        struct ResultStorageTraits<Type&> {
+            using Stored = Type*;
+
+            template <class Arg>
+            static constexpr Stored store(Arg&& arg) noexcept {
+                return std::addressof(static_cast<Type&>(arg));
+            }
+
+            static constexpr Type& get(Stored const& stored) noexcept {
+                return *stored;
+            }
+        };
+
+        template <>
+        struct ResultStorageTraits<void> : ResultStorageTraits<std::monostate> {};
+
+        /// @brief The niche of the stored representation of a side of a Result
+        template <class Type>
+        struct ResultStoredNiche {};
+
+        template <class Type>
+            requires HasResultNiche<Type>
+        struct ResultStoredNiche<Type> {
+            static constexpr Type value() noexcept {
+                return ResultNiche<Type>::value();
+            }
+        };
 
+        // A stored reference is never null
+        template <class Type>
+        struct ResultStoredNiche<Type&> {
+            static constexpr Type* value() noexcept {
+                return nullptr;
+            }
+        };
+
+        template <class Type>
+        concept HasStoredNiche = requires { ResultStoredNiche<Type>::value(); };
+
+        /// @brief A tagged union of the two sides of a Result
+        /// @note Unlike std::variant, there is no valueless state and the
+        /// discriminant is a single bool, so checking the state is a single load
         template <class OkType, class ErrType>
-        class ResultData {
+        class ResultStorage {
         protected:
-            using ProtectedOkType = std::conditional_t<
-                std::is_reference_v<OkType>,
-                std::reference_wrapper<std::remove_reference_t<OkType>>, OkType>;
-            using ProtectedErrType = std::conditional_t<
-                std::is_reference_v<ErrType>,
-                std::reference_wrapper<std::remove_reference_t<ErrType>>, ErrType>;
+            using OkTraits = ResultStorageTraits<OkType>;
+            using ErrTraits = ResultStorageTraits<ErrType>;
+            using OkStored = typename OkTraits::Stored;
+            using ErrStored = typename ErrTraits::Stored;
+
+            static constexpr bool IsCopyConstructible =
+                std::is_copy_constructible_v<OkStored> && std::is_copy_constructible_v<ErrStored>;
+            static constexpr bool IsMoveConstructible =
+                std::is_move_constructible_v<OkStored> && std::is_move_constructible_v<ErrStored>;
+            static constexpr bool IsCopyAssignable =
+                IsCopyConstructible && std::is_copy_assignable_v<OkStored> && std::is_copy_assignable_v<ErrStored>;
+            static constexpr bool IsMoveAssignable =
+                IsMoveConstructible && std::is_move_assignable_v<OkStored> && std::is_move_assignable_v<ErrStored>;
+
+            static constexpr bool IsTriviallyDestructible =
+                std::is_trivially_destructible_v<OkStored> && std::is_trivially_destructible_v<ErrStored>;
+            static constexpr bool IsTriviallyCopyConstructible =
+                std::is_trivially_copy_constructible_v<OkStored> && std::is_trivially_copy_constructible_v<ErrStored>;
+            static constexpr bool IsTriviallyMoveConstructible =
+                std::is_trivially_move_constructible_v<OkStored> && std::is_trivially_move_constructible_v<ErrStored>;
+            static constexpr bool IsTriviallyCopyAssignable = IsTriviallyDestructible &&
+                IsTriviallyCopyConstructible && std::is_trivially_copy_assignable_v<OkStored> &&
+                std::is_trivially_copy_assignable_v<ErrStored>;
+            static constexpr bool IsTriviallyMoveAssignable = IsTriviallyDestructible &&
+                IsTriviallyMoveConstructible && std::is_trivially_move_assignable_v<OkStored> &&
+                std::is_trivially_move_assignable_v<ErrStored>;
+
+            union {
+                OkStored m_ok;
+                ErrStored m_err;
+            };
+
+            bool m_isOk;
 
-            std::variant<ProtectedOkType, ProtectedErrType> m_data;
+        public:
+            constexpr explicit ResultStorage(std::in_place_index_t<0>) noexcept
+                requires(std::is_void_v<OkType>)
+                : m_ok(), m_isOk(true) {}
+
+            constexpr explicit ResultStorage(std::in_place_index_t<1>) noexcept
+                requires(std::is_void_v<ErrType>)
+                : m_err(), m_isOk(false) {}
+
+            template <class Arg>
+            constexpr explicit ResultStorage(std::in_place_index_t<0>, Arg&& ok) noexcept(
+                std::is_nothrow_constructible_v<OkStored, decltype(OkTraits::store(std::declval<Arg>()))>
+            ) : m_ok(OkTraits::store(std::forward<Arg>(ok))), m_isOk(true) {}
+
+            template <class Arg>
+            constexpr explicit ResultStorage(std::in_place_index_t<1>, Arg&& err) noexcept(
+                std::is_nothrow_constructible_v<ErrStored, decltype(ErrTraits::store(std::declval<Arg>()))>
+            ) : m_err(ErrTraits::store(std::forward<Arg>(err))), m_isOk(false) {}
+
+            constexpr ResultStorage(ResultStorage const&) requires(IsTriviallyCopyConstructible) = default;
+
+            constexpr ResultStorage(ResultStorage const& other) noexcept(
+                std::is_nothrow_copy_constructible_v<OkStored> && std::is_nothrow_copy_constructible_v<ErrStored>
+            )
+                requires(IsCopyConstructible && !IsTriviallyCopyConstructible)
+                : m_isOk(other.m_isOk) {
+                if (m_isOk) {
+                    std::construct_at(std::addressof(m_ok), other.m_ok);
+                }
+                else {
+                    std::construct_at(std::addressof(m_err), other.m_err);
+                }
+            }
 
-            template <std::size_t Index, class ClassType>
-                requires(Index == 0 ? std::constructible_from<ProtectedOkType, ClassType> : std::constructible_from<ProtectedErrType, ClassType>)
-            constexpr ResultData(
-                std::in_place_index_t<Index> index, ClassType&& ok
-            ) noexcept(Index == 0 ? std::is_nothrow_constructible_v<ProtectedOkType, ClassType> : std::is_nothrow_constructible_v<ProtectedErrType, ClassType>) :
-                m_data(index, std::move(ok)) {}
+            constexpr ResultStorage(ResultStorage&&) requires(IsTriviallyMoveConstructible) = default;
+
+            constexpr ResultStorage(ResultStorage&& other) noexcept(
+                std::is_nothrow_move_constructible_v<OkStored> && std::is_nothrow_move_constructible_v<ErrStored>
+            )
+                requires(IsMoveConstructible && !IsTriviallyMoveConstructible)
+                : m_isOk(other.m_isOk) {
+                if (m_isOk) {
+                    std::construct_at(std::addressof(m_ok), std::move(other.m_ok));
+                }
+                else {
+                    std::construct_at(std::addressof(m_err), std::move(other.m_err));
+                }
+            }
+
+            constexpr ResultStorage& operator=(ResultStorage const&) requires(IsTriviallyCopyAssignable) = default;
+
+            constexpr ResultStorage& operator=(ResultStorage const& other) noexcept(
+                std::is_nothrow_copy_constructible_v<OkStored> && std::is_nothrow_copy_constructible_v<ErrStored> &&
+                std::is_nothrow_copy_assignable_v<OkStored> && std::is_nothrow_copy_assignable_v<ErrStored>
+            )
+                requires(IsCopyAssignable && !IsTriviallyCopyAssignable)
+            {
+                this->assign(other);
+                return *this;
+            }
+
+            constexpr ResultStorage& operator=(ResultStorage&&) requires(IsTriviallyMoveAssignable) = default;
+
+            constexpr ResultStorage& operator=(ResultStorage&& other) noexcept(
+                std::is_nothrow_move_constructible_v<OkStored> && std::is_nothrow_move_constructible_v<ErrStored> &&
+                std::is_nothrow_move_assignable_v<OkStored> && std::is_nothrow_move_assignable_v<ErrStored>
+            )
+                requires(IsMoveAssignable && !IsTriviallyMoveAssignable)
+            {
+                this->assign(std::move(other));
+                return *this;
+            }
 
-            constexpr ResultData(ResultData&& other
-            ) noexcept(std::is_nothrow_move_constructible_v<ProtectedOkType> && std::is_nothrow_move_constructible_v<ProtectedErrType>) :
-                m_data(std::move(other.m_data)) {}
+            constexpr ~ResultStorage() requires(IsTriviallyDestructible) = default;
+
+            constexpr ~ResultStorage() {
+                this->destroy();
+            }
+
+            constexpr bool isOk() const noexcept {
+                return m_isOk;
+            }
+
+            constexpr decltype(auto) ok() & noexcept {
+                return OkTraits::get(m_ok);
+            }
+
+            constexpr decltype(auto) ok() const& noexcept {
+                return OkTraits::get(m_ok);
+            }
+
+            constexpr decltype(auto) ok() && noexcept {
+                return OkTraits::get(std::move(m_ok));
+            }
+
+            constexpr decltype(auto) err() & noexcept {
+                return ErrTraits::get(m_err);
+            }
+
+            constexpr decltype(auto) err() const& noexcept {
+                return ErrTraits::get(m_err);
+            }
+
+            constexpr decltype(auto) err() && noexcept {
+                return ErrTraits::get(std::move(m_err));
+            }
+
+        protected:
+            constexpr void destroy() noexcept {
+                if (m_isOk) {
+                    std::destroy_at(std::addressof(m_ok));
+                }
+                else {
+                    std::destroy_at(std::addressof(m_err));
+                }
+            }
+
+            template <class Other>
+            constexpr void assign(Other&& other) {
+                if (m_isOk && other.m_isOk) {
+                    m_ok = std::forward<Other>(other).m_ok;
+                }
+                else if (!m_isOk && !other.m_isOk) {
+                    m_err = std::forward<Other>(other).m_err;
+                }
+                else if (other.m_isOk) {
+                    this->reinit(m_ok, m_err, std::forward<Other>(other).m_ok);
+                    m_isOk = true;
+                }
+                else {
+                    this->reinit(m_err, m_ok, std::forward<Other>(other).m_err);
+                    m_isOk = false;
+                }
+            }
+
+            // Replaces the active member without ever leaving the storage empty,
+            // in the same manner as std::expected
+            template <class New, class Old, class Arg>
+            static constexpr void reinit(New& newValue, Old& oldValue, Arg&& arg) {
+                if constexpr (std::is_nothrow_constructible_v<New, Arg>) {
+                    std::destroy_at(std::addressof(oldValue));
+                    std::construct_at(std::addressof(newValue), std::forward<Arg>(arg));
+                }
+                else if constexpr (std::is_nothrow_move_constructible_v<New>) {
+                    New temp(std::forward<Arg>(arg));
+                    std::destroy_at(std::addressof(oldValue));
+                    std::construct_at(std::addressof(newValue), std::move(temp));
+                }
+                else {
+                    Old temp(std::move(oldValue));
+                    std::destroy_at(std::addressof(oldValue));
+#if __cpp_exceptions
+                    try {
+                        std::construct_at(std::addressof(newValue), std::forward<Arg>(arg));
+                    }
+                    catch (...) {
+                        std::construct_at(std::addressof(oldValue), std::move(temp));
+                        throw;
+                    }
+#else
+                    std::construct_at(std::addressof(newValue), std::forward<Arg>(arg));
+#endif
+                }
+            }
+        };
+
+        // When the other side is void, the state can be read out of the niche of the stored value
+        template <class OkType>
+            requires HasStoredNiche<OkType>
+        class ResultStorage<OkType, void> {
+        protected:
+            using OkTraits = ResultStorageTraits<OkType>;
+            using OkNiche = ResultStoredNiche<OkType>;
+
+            typename OkTraits::Stored m_ok;
 
-            constexpr ResultData(ResultData const& other
-            ) noexcept(std::is_nothrow_copy_constructible_v<ProtectedOkType> && std::is_nothrow_copy_constructible_v<ProtectedErrType>) :
-                m_data(other.m_data) {}
+        public:
+            template <class Arg>
+            constexpr explicit ResultStorage(std::in_place_index_t<0>, Arg&& ok) noexcept :
+                m_ok(OkTraits::store(std::forward<Arg>(ok))) {}
+
+            constexpr explicit ResultStorage(std::in_place_index_t<1>) noexcept : m_ok(OkNiche::value()) {}
+
+            constexpr bool isOk() const noexcept {
+                return !(m_ok == OkNiche::value());
+            }
+
+            constexpr decltype(auto) ok() & noexcept {
+                return OkTraits::get(m_ok);
+            }
+
+            constexpr decltype(auto) ok() const& noexcept {
+                return OkTraits::get(m_ok);
+            }
+
+            constexpr decltype(auto) ok() && noexcept {
+                return OkTraits::get(std::move(m_ok));
+            }
+
+            constexpr std::monostate err() const noexcept {
+                return std::monostate();
+            }
+        };
+
+        template <class ErrType>
+            requires HasStoredNiche<ErrType>
+        class ResultStorage<void, ErrType> {
+        protected:
+            using ErrTraits = ResultStorageTraits<ErrType>;
+            using ErrNiche = ResultStoredNiche<ErrType>;
+
+            typename ErrTraits::Stored m_err;
+
+        public:
+            constexpr explicit ResultStorage(std::in_place_index_t<0>) noexcept : m_err(ErrNiche::value()) {}
+
+            template <class Arg>
+            constexpr explicit ResultStorage(std::in_place_index_t<1>, Arg&& err) noexcept :
+                m_err(ErrTraits::store(std::forward<Arg>(err))) {}
+
+            constexpr bool isOk() const noexcept {
+                return m_err == ErrNiche::value();
+            }
+
+            constexpr std::monostate ok() const noexcept {
+                return std::monostate();
+            }
+
+            constexpr decltype(auto) err() & noexcept {
+                return ErrTraits::get(m_err);
+            }
+
+            constexpr decltype(auto) err() const& noexcept {
+                return ErrTraits::get(m_err);
+            }
+
+            constexpr decltype(auto) err() && noexcept {
+                return ErrTraits::get(std::move(m_err));
+            }
+        };
+
+        // Neither side has a value, so the state is all there is
+        template <>
+        class ResultStorage<void, void> {
+        protected:
+            bool m_isOk;
+
+        public:
+            constexpr explicit ResultStorage(std::in_place_index_t<0>) noexcept : m_isOk(true) {}
+
+            constexpr explicit ResultStorage(std::in_place_index_t<1>) noexcept : m_isOk(false) {}
+
+            constexpr bool isOk() const noexcept {
+                return m_isOk;
+            }
+
+            constexpr std::monostate ok() const noexcept {
+                return std::monostate();
+            }
+
+            constexpr std::monostate err() const noexcept {
+                return std::monostate();
+            }
+        };
+    }
+
+    namespace impl {
+        template <class OkType, class ErrType>
+        class ResultData {
+        protected:
+            ResultStorage<OkType, ErrType> m_data;
+
+            template <std::size_t Index, class ClassType>
+                requires(Index == 0 ? std::constructible_from<OkType, ClassType> : std::constructible_from<ErrType, ClassType>)
+            constexpr ResultData(
+                std::in_place_index_t<Index> index, ClassType&& value
+            ) noexcept(std::is_nothrow_constructible_v<ResultStorage<OkType, ErrType>, std::in_place_index_t<Index>, ClassType>) :
+                m_data(index, std::forward<ClassType>(value)) {}
+
+            constexpr ResultData(ResultData&&) = default;
+            constexpr ResultData(ResultData const&) = default;
+            constexpr ResultData& operator=(ResultData&&) = default;
+            constexpr ResultData& operator=(ResultData const&) = default;
         public:
             constexpr OkContainer<OkType> asOk() && noexcept
                 requires(!std::is_reference_v<OkType>)
             {
-                return Ok(std::move(*std::get_if<0>(&m_data)));
+                return Ok(std::move(m_data).ok());
             }
 
             constexpr OkContainer<OkType> asOk() const& noexcept
                 requires(!std::is_reference_v<OkType>)
             {
-                return Ok(static_cast<OkType>(*std::get_if<0>(&m_data)));
+                return Ok(static_cast<OkType>(m_data.ok()));
             }
 
             constexpr OkContainer<OkType&> asOk() && noexcept
                 requires(std::is_reference_v<OkType>)
             {
-                return Ok(std::get_if<0>(&m_data)->get());
+                return Ok(m_data.ok());
             }
 
             constexpr OkContainer<OkType&> asOk() const& noexcept
                 requires(std::is_reference_v<OkType>)
             {
-                return Ok(std::get_if<0>(&m_data)->get());
+                return Ok(m_data.ok());
             }
 
             constexpr ErrContainer<ErrType> asErr() && noexcept
                 requires(!std::is_reference_v<ErrType>)
             {
-                return Err(std::move(*std::get_if<1>(&m_data)));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(std::move(m_data).err()));
             }
 
             constexpr ErrContainer<ErrType> asErr() const& noexcept
                 requires(!std::is_reference_v<ErrType>)
             {
-                return Err(static_cast<ErrType>(*std::get_if<1>(&m_data)));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(static_cast<ErrType>(m_data.err())));
             }
 
             constexpr ErrContainer<ErrType&> asErr() && noexcept
                 requires(std::is_reference_v<ErrType>)
             {
-                return Err(std::get_if<1>(&m_data)->get());
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
 
             constexpr ErrContainer<ErrType&> asErr() const& noexcept
                 requires(std::is_reference_v<ErrType>)
             {
-                return Err(std::get_if<1>(&m_data)->get());
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
 
             /// @brief Returns true if the Result is Ok
             /// @return true if the Result is Ok
             constexpr bool isOk() const noexcept {
-                return m_data.index() == 0;
+                return m_data.isOk();
             }
 
             /// @brief Returns true if the Result is Err
             /// @return true if the Result is Err
             constexpr bool isErr() const noexcept {
-                return m_data.index() == 1;
+                return !m_data.isOk();
             }
 
             /// @brief Unwraps the Ok value from the Result
             /// @throw UnwrapException if the Result is Err
             /// @return the Ok value
             constexpr OkType&& unwrap() && {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return std::move(*ptr);
+                if (m_data.isOk()) [[likely]] {
+                    return std::move(m_data).ok();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(ErrTag{}, *std::get_if<1>(&m_data)));
+                    unwrapFailed(ErrTag{}, m_data.err());
                 }
             }
 
@@ -550,11 +1596,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Err
             /// @return the Ok value
             constexpr OkType& unwrap() & {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) [[likely]] {
+                    return m_data.ok();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(ErrTag{}, *std::get_if<1>(&m_data)));
+                    unwrapFailed(ErrTag{}, m_data.err());
                 }
             }
 
@@ -562,11 +1608,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Err
             /// @return the Ok value
             constexpr OkType const& unwrap() const& {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) [[likely]] {
+                    return m_data.ok();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(ErrTag{}, *std::get_if<1>(&m_data)));
+                    unwrapFailed(ErrTag{}, m_data.err());
                 }
             }
 
@@ -574,11 +1620,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Ok
             /// @return the Err value
             constexpr ErrType&& unwrapErr() && {
-                if (auto* ptr = std::get_if<1>(&m_data)) {
-                    return std::move(*ptr);
+                if (!m_data.isOk()) [[likely]] {
+                    return std::move(m_data).err();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(OkTag{}, *std::get_if<0>(&m_data)));
+                    unwrapFailed(OkTag{}, m_data.ok());
                 }
             }
 
@@ -586,11 +1632,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Ok
             /// @return the Err value
             constexpr ErrType& unwrapErr() & {
-                if (auto* ptr = std::get_if<1>(&m_data)) {
-                    return *ptr;
+                if (!m_data.isOk()) [[likely]] {
+                    return m_data.err();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(OkTag{}, *std::get_if<0>(&m_data)));
+                    unwrapFailed(OkTag{}, m_data.ok());
                 }
             }
 
@@ -598,11 +1644,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Ok
             /// @return the Err value
             constexpr ErrType const& unwrapErr() const& {
-                if (auto* ptr = std::get_if<1>(&m_data)) {
-                    return *ptr;
+                if (!m_data.isOk()) [[likely]] {
+                    return m_data.err();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(OkTag{}, *std::get_if<0>(&m_data)));
+                    unwrapFailed(OkTag{}, m_data.ok());
                 }
             }
 
@@ -620,8 +1666,8 @@ namespace geode {
             ) && noexcept(std::is_nothrow_default_constructible_v<OkType> && std::is_nothrow_move_constructible_v<OkType>)
                 requires std::default_initializable<OkType>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return std::move(*ptr);
+                if (m_data.isOk()) {
+                    return std::move(m_data).ok();
                 }
                 else {
                     return OkType();
@@ -634,8 +1680,8 @@ namespace geode {
             ) const& noexcept(std::is_nothrow_default_constructible_v<OkType> && std::is_nothrow_move_constructible_v<OkType>)
                 requires std::default_initializable<OkType>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) {
+                    return m_data.ok();
                 }
                 else {
                     return OkType();
@@ -649,8 +1695,8 @@ namespace geode {
             ) && noexcept(std::is_nothrow_move_constructible_v<OkType>)
                 requires std::constructible_from<OkType, decltype(defaultValue)>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return std::move(*ptr);
+                if (m_data.isOk()) {
+                    return std::move(m_data).ok();
                 }
                 else {
                     return defaultValue;
@@ -664,8 +1710,8 @@ namespace geode {
             ) const& noexcept(std::is_nothrow_move_constructible_v<OkType>)
                 requires std::constructible_from<OkType, decltype(defaultValue)>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) {
+                    return m_data.ok();
                 }
                 else {
                     return defaultValue;
@@ -680,8 +1726,8 @@ namespace geode {
             ) && noexcept(std::is_nothrow_invocable_v<decltype(operation)>)
                 requires std::constructible_from<OkType, std::invoke_result_t<decltype(operation)>>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return std::move(*ptr);
+                if (m_data.isOk()) {
+                    return std::move(m_data).ok();
                 }
                 else {
                     return operation();
@@ -696,8 +1742,8 @@ namespace geode {
             ) const& noexcept(std::is_nothrow_invocable_v<decltype(operation)>)
                 requires std::constructible_from<OkType, std::invoke_result_t<decltype(operation)>>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) {
+                    return m_data.ok();
                 }
                 else {
                     return operation();
@@ -713,15 +1759,15 @@ namespace geode {
         protected:
             constexpr void inspectInternal(std::invocable<OkType const&> auto&& operation) const
                 noexcept(noexcept(operation(std::declval<OkType const&>()))) {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    operation(*ptr);
+                if (m_data.isOk()) {
+                    operation(m_data.ok());
                 }
             }
 
             constexpr void inspectInternalErr(std::invocable<ErrType const&> auto&& operation) const
                 noexcept(noexcept(operation(std::declval<ErrType const&>()))) {
-                if (auto* ptr = std::get_if<1>(&m_data)) {
-                    operation(*ptr);
+                if (!m_data.isOk()) {
+                    operation(m_data.err());
                 }
             }
         };
@@ -729,28 +1775,22 @@ namespace geode {
         template <class ErrType>
         class ResultData<void, ErrType> {
         protected:
-            using ProtectedErrType = std::conditional_t<
-                std::is_reference_v<ErrType>,
-                std::reference_wrapper<std::remove_reference_t<ErrType>>, ErrType>;
-            std::variant<std::monostate, ProtectedErrType> m_data;
+            ResultStorage<void, ErrType> m_data;
 
             template <std::size_t Index, class ClassType>
                 requires std::constructible_from<ErrType, ClassType>
             constexpr ResultData(
                 std::in_place_index_t<Index> index, ClassType&& err
-            ) noexcept(std::is_nothrow_constructible_v<ProtectedErrType, ClassType>) :
-                m_data(index, std::move(err)) {}
+            ) noexcept(std::is_nothrow_constructible_v<ResultStorage<void, ErrType>, std::in_place_index_t<Index>, ClassType>) :
+                m_data(index, std::forward<ClassType>(err)) {}
 
             template <std::size_t Index>
             constexpr ResultData(std::in_place_index_t<Index> index) noexcept : m_data(index) {}
 
-            constexpr ResultData(ResultData&& other
-            ) noexcept(std::is_nothrow_move_constructible_v<ProtectedErrType>) :
-                m_data(std::move(other.m_data)) {}
-
-            constexpr ResultData(ResultData const& other
-            ) noexcept(std::is_nothrow_copy_constructible_v<ProtectedErrType>) :
-                m_data(other.m_data) {}
+            constexpr ResultData(ResultData&&) = default;
+            constexpr ResultData(ResultData const&) = default;
+            constexpr ResultData& operator=(ResultData&&) = default;
+            constexpr ResultData& operator=(ResultData const&) = default;
 
         public:
             constexpr OkContainer<void> asOk() const noexcept {
@@ -760,44 +1800,44 @@ namespace geode {
             constexpr ErrContainer<ErrType> asErr() && noexcept
                 requires(!std::is_reference_v<ErrType>)
             {
-                return Err(std::move(*std::get_if<1>(&m_data)));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(std::move(m_data).err()));
             }
 
             constexpr ErrContainer<ErrType> asErr() const& noexcept
                 requires(!std::is_reference_v<ErrType>)
             {
-                return Err(static_cast<ErrType>(*std::get_if<1>(&m_data)));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(static_cast<ErrType>(m_data.err())));
             }
 
             constexpr ErrContainer<ErrType&> asErr() && noexcept
                 requires(std::is_reference_v<ErrType>)
             {
-                return Err(std::get_if<1>(&m_data)->get());
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
 
             constexpr ErrContainer<ErrType&> asErr() const& noexcept
                 requires(std::is_reference_v<ErrType>)
             {
-                return Err(std::get_if<1>(&m_data)->get());
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
 
             /// @brief Returns true if the Result is Ok
             /// @return true if the Result is Ok
             constexpr bool isOk() const noexcept {
-                return m_data.index() == 0;
+                return m_data.isOk();
             }
 
             /// @brief Returns true if the Result is Err
             /// @return true if the Result is Err
             constexpr bool isErr() const noexcept {
-                return m_data.index() == 1;
+                return !m_data.isOk();
             }
 
             /// @brief Unwraps the Result
             /// @throw UnwrapException if the Result is Err
             constexpr void unwrap() {
-                if (isErr()) {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(ErrTag{}, *std::get_if<1>(&m_data)));
+                if (isErr()) [[unlikely]] {
+                    unwrapFailed(ErrTag{}, m_data.err());
                 }
             }
 
@@ -805,11 +1845,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Ok
             /// @return the Err value
             constexpr ErrType&& unwrapErr() && {
-                if (auto* ptr = std::get_if<1>(&m_data)) {
-                    return std::move(*ptr);
+                if (!m_data.isOk()) [[likely]] {
+                    return std::move(m_data).err();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(OkTag{}, *std::get_if<0>(&m_data)));
+                    unwrapFailed(OkTag{}, m_data.ok());
                 }
             }
 
@@ -817,11 +1857,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Ok
             /// @return the Err value
             constexpr ErrType& unwrapErr() & {
-                if (auto* ptr = std::get_if<1>(&m_data)) {
-                    return *ptr;
+                if (!m_data.isOk()) [[likely]] {
+                    return m_data.err();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(OkTag{}, *std::get_if<0>(&m_data)));
+                    unwrapFailed(OkTag{}, m_data.ok());
                 }
             }
 
@@ -829,11 +1869,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Ok
             /// @return the Err value
             constexpr ErrType const& unwrapErr() const& {
-                if (auto* ptr = std::get_if<1>(&m_data)) {
-                    return *ptr;
+                if (!m_data.isOk()) [[likely]] {
+                    return m_data.err();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(OkTag{}, *std::get_if<0>(&m_data)));
+                    unwrapFailed(OkTag{}, m_data.ok());
                 }
             }
 
@@ -852,8 +1892,8 @@ namespace geode {
         protected:
             constexpr void inspectInternalErr(std::invocable<ErrType const&> auto&& operation) const
                 noexcept(noexcept(operation(std::declval<ErrType const&>()))) {
-                if (auto* ptr = std::get_if<1>(&m_data)) {
-                    operation(*ptr);
+                if (!m_data.isOk()) {
+                    operation(m_data.err());
                 }
             }
         };
@@ -861,79 +1901,73 @@ namespace geode {
         template <class OkType>
         class ResultData<OkType, void> {
         protected:
-            using ProtectedOkType = std::conditional_t<
-                std::is_reference_v<OkType>,
-                std::reference_wrapper<std::remove_reference_t<OkType>>, OkType>;
-            std::variant<ProtectedOkType, std::monostate> m_data;
+            ResultStorage<OkType, void> m_data;
 
             template <std::size_t Index, class ClassType>
                 requires std::constructible_from<OkType, ClassType>
             constexpr ResultData(
                 std::in_place_index_t<Index> index, ClassType&& ok
-            ) noexcept(std::is_nothrow_constructible_v<ProtectedOkType, ClassType>) :
-                m_data(index, std::move(ok)) {}
+            ) noexcept(std::is_nothrow_constructible_v<ResultStorage<OkType, void>, std::in_place_index_t<Index>, ClassType>) :
+                m_data(index, std::forward<ClassType>(ok)) {}
 
             template <std::size_t Index>
             constexpr ResultData(std::in_place_index_t<Index> index) noexcept : m_data(index) {}
 
-            constexpr ResultData(ResultData&& other
-            ) noexcept(std::is_nothrow_move_constructible_v<ProtectedOkType>) :
-                m_data(std::move(other.m_data)) {}
-
-            constexpr ResultData(ResultData const& other
-            ) noexcept(std::is_nothrow_copy_constructible_v<ProtectedOkType>) :
-                m_data(other.m_data) {}
+            constexpr ResultData(ResultData&&) = default;
+            constexpr ResultData(ResultData const&) = default;
+            constexpr ResultData& operator=(ResultData&&) = default;
+            constexpr ResultData& operator=(ResultData const&) = default;
 
         public:
             constexpr OkContainer<OkType> asOk() && noexcept
                 requires(!std::is_reference_v<OkType>)
             {
-                return Ok(std::move(*std::get_if<0>(&m_data)));
+                return Ok(std::move(m_data).ok());
             }
 
             constexpr OkContainer<OkType> asOk() const& noexcept
                 requires(!std::is_reference_v<OkType>)
             {
-                return Ok(static_cast<OkType>(*std::get_if<0>(&m_data)));
+                return Ok(static_cast<OkType>(m_data.ok()));
             }
 
             constexpr OkContainer<OkType&> asOk() && noexcept
                 requires(std::is_reference_v<OkType>)
             {
-                return Ok(std::get_if<0>(&m_data)->get());
+                return Ok(m_data.ok());
             }
 
             constexpr OkContainer<OkType&> asOk() const& noexcept
                 requires(std::is_reference_v<OkType>)
             {
-                return Ok(std::get_if<0>(&m_data)->get());
+                return Ok(m_data.ok());
             }
 
             constexpr ErrContainer<void> asErr() const noexcept {
-                return Err();
+                return GEODE_RESULT_IMPL_PROPAGATED(Err());
             }
 
             /// @brief Returns true if the Result is Ok
             /// @return true if the Result is Ok
             constexpr bool isOk() const noexcept {
-                return m_data.index() == 0;
+                return m_data.isOk();
             }
 
             /// @brief Returns true if the Result is Err
             /// @return true if the Result is Err
             constexpr bool isErr() const noexcept {
-                return m_data.index() == 1;
+                return !m_data.isOk();
             }
 
             /// @brief Unwraps the Ok value from the Result
             /// @throw UnwrapException if the Result is Err
             /// @return the Ok value
             constexpr OkType&& unwrap() && {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return std::move(*ptr);
+                if (m_data.isOk()) [[likely]] {
+                    return std::move(m_data).ok();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(ErrTag{}, *std::get_if<1>(&m_data)));
+                    unwrapFailed(ErrTag{}, m_data.err());
                 }
             }
 
@@ -941,11 +1975,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Err
             /// @return the Ok value
             constexpr OkType& unwrap() & {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) [[likely]] {
+                    return m_data.ok();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(ErrTag{}, *std::get_if<1>(&m_data)));
+                    unwrapFailed(ErrTag{}, m_data.err());
                 }
             }
 
@@ -953,11 +1987,11 @@ namespace geode {
             /// @throw UnwrapException if the Result is Err
             /// @return the Ok value
             constexpr OkType const& unwrap() const& {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) [[likely]] {
+                    return m_data.ok();
                 }
                 else {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(ErrTag{}, *std::get_if<1>(&m_data)));
+                    unwrapFailed(ErrTag{}, m_data.err());
                 }
             }
 
@@ -965,8 +1999,8 @@ namespace geode {
             /// @throw UnwrapException if the Result is Ok
             /// @return the Err value
             constexpr void unwrapErr() {
-                if (isOk()) {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(OkTag{}, *std::get_if<0>(&m_data)));
+                if (isOk()) [[unlikely]] {
+                    unwrapFailed(OkTag{}, m_data.ok());
                 }
             }
 
@@ -984,8 +2018,8 @@ namespace geode {
             ) && noexcept(std::is_nothrow_default_constructible_v<OkType> && std::is_nothrow_move_constructible_v<OkType>)
                 requires std::default_initializable<OkType>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return std::move(*ptr);
+                if (m_data.isOk()) {
+                    return std::move(m_data).ok();
                 }
                 else {
                     return OkType();
@@ -998,8 +2032,8 @@ namespace geode {
             ) const& noexcept(std::is_nothrow_default_constructible_v<OkType> && std::is_nothrow_move_constructible_v<OkType>)
                 requires std::default_initializable<OkType>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) {
+                    return m_data.ok();
                 }
                 else {
                     return OkType();
@@ -1013,8 +2047,8 @@ namespace geode {
             ) && noexcept(std::is_nothrow_move_constructible_v<OkType>)
                 requires std::constructible_from<OkType, decltype(defaultValue)>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return std::move(*ptr);
+                if (m_data.isOk()) {
+                    return std::move(m_data).ok();
                 }
                 else {
                     return defaultValue;
@@ -1028,8 +2062,8 @@ namespace geode {
             ) const& noexcept(std::is_nothrow_move_constructible_v<OkType>)
                 requires std::constructible_from<OkType, decltype(defaultValue)>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) {
+                    return m_data.ok();
                 }
                 else {
                     return defaultValue;
@@ -1044,8 +2078,8 @@ namespace geode {
             ) && noexcept(std::is_nothrow_invocable_v<decltype(operation)>)
                 requires std::constructible_from<OkType, std::invoke_result_t<decltype(operation)>>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return std::move(*ptr);
+                if (m_data.isOk()) {
+                    return std::move(m_data).ok();
                 }
                 else {
                     return operation();
@@ -1060,8 +2094,8 @@ namespace geode {
             ) const& noexcept(std::is_nothrow_invocable_v<decltype(operation)>)
                 requires std::constructible_from<OkType, std::invoke_result_t<decltype(operation)>>
             {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    return *ptr;
+                if (m_data.isOk()) {
+                    return m_data.ok();
                 }
                 else {
                     return operation();
@@ -1077,8 +2111,8 @@ namespace geode {
         protected:
             constexpr void inspectInternal(std::invocable<OkType const&> auto&& operation) const
                 noexcept(noexcept(operation(std::declval<OkType const&>()))) {
-                if (auto* ptr = std::get_if<0>(&m_data)) {
-                    operation(*ptr);
+                if (m_data.isOk()) {
+                    operation(m_data.ok());
                 }
             }
         };
@@ -1086,15 +2120,16 @@ namespace geode {
         template <>
         class ResultData<void, void> {
         protected:
-            std::variant<std::monostate, std::monostate> m_data;
+            ResultStorage<void, void> m_data;
 
             template <std::size_t Index>
             constexpr inline ResultData(std::in_place_index_t<Index> index) noexcept :
                 m_data(index) {}
 
-            constexpr inline ResultData(ResultData&&) noexcept {}
-
-            constexpr inline ResultData(ResultData const&) noexcept {}
+            constexpr ResultData(ResultData&&) = default;
+            constexpr ResultData(ResultData const&) = default;
+            constexpr ResultData& operator=(ResultData&&) = default;
+            constexpr ResultData& operator=(ResultData const&) = default;
 
         public:
             constexpr inline OkContainer<void> asOk() const noexcept {
@@ -1102,26 +2137,26 @@ namespace geode {
             }
 
             constexpr inline ErrContainer<void> asErr() const noexcept {
-                return Err();
+                return GEODE_RESULT_IMPL_PROPAGATED(Err());
             }
 
             /// @brief Returns true if the Result is Ok
             /// @return true if the Result is Ok
             constexpr inline bool isOk() const noexcept {
-                return m_data.index() == 0;
+                return m_data.isOk();
             }
 
             /// @brief Returns true if the Result is Err
             /// @return true if the Result is Err
             constexpr inline bool isErr() const noexcept {
-                return m_data.index() == 1;
+                return !m_data.isOk();
             }
 
             /// @brief Unwraps the Result
             /// @throw UnwrapException if the Result is Err
             constexpr void unwrap() {
-                if (isErr()) {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(ErrTag{}, *std::get_if<1>(&m_data)));
+                if (isErr()) [[unlikely]] {
+                    unwrapFailed(ErrTag{}, m_data.err());
                 }
             }
 
@@ -1129,8 +2164,8 @@ namespace geode {
             /// @throw UnwrapException if the Result is Ok
             /// @return the Err value
             constexpr void unwrapErr() {
-                if (isOk()) {
-                    GEODE_RESULT_IMPL_THROW(UnwrapException(OkTag{}, *std::get_if<0>(&m_data)));
+                if (isOk()) [[unlikely]] {
+                    unwrapFailed(OkTag{}, m_data.ok());
                 }
             }
 
@@ -1150,121 +2185,137 @@ namespace geode {
         template <class OkType, class ErrType>
         class ResultDataWrapper : public ResultData<OkType, ErrType> {
         public:
+            /// @brief Constructs the Ok (index 0) or Err (index 1) value in place,
+            /// without going through an OkContainer or ErrContainer
+            template <std::size_t Index, class... Args>
+            constexpr explicit ResultDataWrapper(std::in_place_index_t<Index> index, Args&&... args) noexcept(
+                std::is_nothrow_constructible_v<ResultStorage<OkType, ErrType>, std::in_place_index_t<Index>, Args...>
+            ) : ResultData<OkType, ErrType>(index, std::forward<Args>(args)...) {}
+
             template <class OkType2>
                 requires std::constructible_from<OkType, OkType2>
             constexpr ResultDataWrapper(OkContainer<OkType2>&& ok
             ) noexcept(std::
                            is_nothrow_constructible_v<
                                ResultData<OkType, ErrType>, std::in_place_index_t<0>, OkType2>) :
-                ResultData<OkType, ErrType>(std::in_place_index<0>, std::move(ok).unwrap()) {}
+                ResultData<OkType, ErrType>(std::in_place_index<0>, static_cast<OkType2&&>(std::move(ok).unwrap())) {}
 
             template <class ErrType2>
                 requires std::constructible_from<ErrType, ErrType2>
-            constexpr ResultDataWrapper(ErrContainer<ErrType2>&& err
+            constexpr ResultDataWrapper(ErrContainer<ErrType2>&& err GEODE_RESULT_IMPL_ERR_SITE
             ) noexcept(std::
                            is_nothrow_constructible_v<
                                ResultData<OkType, ErrType>, std::in_place_index_t<1>, ErrType2>) :
-                ResultData<OkType, ErrType>(std::in_place_index<1>, std::move(err).unwrap()) {}
-
-            constexpr ResultDataWrapper(ResultDataWrapper&& other
-            ) noexcept(std::is_nothrow_move_constructible_v<ResultData<OkType, ErrType>>) :
-                ResultData<OkType, ErrType>(std::move(other)) {}
+                ResultData<OkType, ErrType>(std::in_place_index<1>, static_cast<ErrType2&&>(std::move(err).unwrap())) {
+                GEODE_RESULT_IMPL_REPORT_ERR(err)
+            }
 
-            constexpr ResultDataWrapper(ResultDataWrapper const& other
-            ) noexcept(std::is_nothrow_copy_constructible_v<ResultData<OkType, ErrType>>) :
-                ResultData<OkType, ErrType>(other) {}
+            constexpr ResultDataWrapper(ResultDataWrapper&&) = default;
+            constexpr ResultDataWrapper(ResultDataWrapper const&) = default;
+            constexpr ResultDataWrapper& operator=(ResultDataWrapper&&) = default;
+            constexpr ResultDataWrapper& operator=(ResultDataWrapper const&) = default;
         };
 
         template <class OkType>
         class ResultDataWrapper<OkType, void> : public ResultData<OkType, void> {
         public:
+            /// @brief Constructs the Ok (index 0) or Err (index 1) value in place,
+            /// without going through an OkContainer or ErrContainer
+            template <std::size_t Index, class... Args>
+            constexpr explicit ResultDataWrapper(std::in_place_index_t<Index> index, Args&&... args) noexcept(
+                std::is_nothrow_constructible_v<ResultStorage<OkType, void>, std::in_place_index_t<Index>, Args...>
+            ) : ResultData<OkType, void>(index, std::forward<Args>(args)...) {}
+
             template <class OkType2>
                 requires std::constructible_from<OkType, OkType2>
             constexpr ResultDataWrapper(OkContainer<OkType2>&& ok
             ) noexcept(std::is_nothrow_constructible_v<ResultData<OkType, void>, std::in_place_index_t<0>, OkType2>) :
-                ResultData<OkType, void>(std::in_place_index<0>, std::move(ok).unwrap()) {}
-
-            constexpr ResultDataWrapper(ErrContainer<void>&&) noexcept(std::is_nothrow_constructible_v<
-                                                                       ResultData<OkType, void>,
-                                                                       std::in_place_index_t<1>>) :
-                ResultData<OkType, void>(std::in_place_index<1>) {}
+                ResultData<OkType, void>(std::in_place_index<0>, static_cast<OkType2&&>(std::move(ok).unwrap())) {}
 
-            constexpr ResultDataWrapper(ResultDataWrapper&& other
-            ) noexcept(std::is_nothrow_move_constructible_v<ResultData<OkType, void>>) :
-                ResultData<OkType, void>(std::move(other)) {}
+            constexpr ResultDataWrapper(ErrContainer<void>&& err GEODE_RESULT_IMPL_ERR_SITE
+            ) noexcept(std::is_nothrow_constructible_v<ResultData<OkType, void>, std::in_place_index_t<1>>) :
+                ResultData<OkType, void>(std::in_place_index<1>) {
+                GEODE_RESULT_IMPL_REPORT_ERR(err)
+                (void)err;
+            }
 
-            constexpr ResultDataWrapper(ResultDataWrapper const& other
-            ) noexcept(std::is_nothrow_copy_constructible_v<ResultData<OkType, void>>) :
-                ResultData<OkType, void>(other) {}
+            constexpr ResultDataWrapper(ResultDataWrapper&&) = default;
+            constexpr ResultDataWrapper(ResultDataWrapper const&) = default;
+            constexpr ResultDataWrapper& operator=(ResultDataWrapper&&) = default;
+            constexpr ResultDataWrapper& operator=(ResultDataWrapper const&) = default;
         };
 
         template <class ErrType>
         class ResultDataWrapper<void, ErrType> : public ResultData<void, ErrType> {
         public:
+            /// @brief Constructs the Ok (index 0) or Err (index 1) value in place,
+            /// without going through an OkContainer or ErrContainer
+            template <std::size_t Index, class... Args>
+            constexpr explicit ResultDataWrapper(std::in_place_index_t<Index> index, Args&&... args) noexcept(
+                std::is_nothrow_constructible_v<ResultStorage<void, ErrType>, std::in_place_index_t<Index>, Args...>
+            ) : ResultData<void, ErrType>(index, std::forward<Args>(args)...) {}
+
             template <class ErrType2>
                 requires std::constructible_from<ErrType, ErrType2>
-            constexpr ResultDataWrapper(ErrContainer<ErrType2>&& err
+            constexpr ResultDataWrapper(ErrContainer<ErrType2>&& err GEODE_RESULT_IMPL_ERR_SITE
             ) noexcept(std::
                            is_nothrow_constructible_v<
                                ResultData<void, ErrType>, std::in_place_index_t<1>, ErrType2>) :
-                ResultData<void, ErrType>(std::in_place_index<1>, std::move(err).unwrap()) {}
+                ResultData<void, ErrType>(std::in_place_index<1>, static_cast<ErrType2&&>(std::move(err).unwrap())) {
+                GEODE_RESULT_IMPL_REPORT_ERR(err)
+            }
 
             constexpr ResultDataWrapper(OkContainer<void>&&) noexcept(std::is_nothrow_constructible_v<
                                                                       ResultData<void, ErrType>,
                                                                       std::in_place_index_t<0>>) :
                 ResultData<void, ErrType>(std::in_place_index<0>) {}
 
-            constexpr ResultDataWrapper(ResultDataWrapper&& other
-            ) noexcept(std::is_nothrow_move_constructible_v<ResultData<void, ErrType>>) :
-                ResultData<void, ErrType>(std::move(other)) {}
-
-            constexpr ResultDataWrapper(ResultDataWrapper const& other
-            ) noexcept(std::is_nothrow_copy_constructible_v<ResultData<void, ErrType>>) :
-                ResultData<void, ErrType>(other) {}
+            constexpr ResultDataWrapper(ResultDataWrapper&&) = default;
+            constexpr ResultDataWrapper(ResultDataWrapper const&) = default;
+            constexpr ResultDataWrapper& operator=(ResultDataWrapper&&) = default;
+            constexpr ResultDataWrapper& operator=(ResultDataWrapper const&) = default;
         };
 
         template <>
         class ResultDataWrapper<void, void> : public ResultData<void, void> {
         public:
+            /// @brief Constructs the Ok (index 0) or Err (index 1) value in place,
+            /// without going through an OkContainer or ErrContainer
+            template <std::size_t Index, class... Args>
+            constexpr explicit ResultDataWrapper(std::in_place_index_t<Index> index, Args&&... args) noexcept(
+                std::is_nothrow_constructible_v<ResultStorage<void, void>, std::in_place_index_t<Index>, Args...>
+            ) : ResultData<void, void>(index, std::forward<Args>(args)...) {}
+
             constexpr inline ResultDataWrapper(OkContainer<void>&&) :
                 ResultData<void, void>(std::in_place_index<0>) {}
 
-            constexpr inline ResultDataWrapper(ErrContainer<void>&&) :
-                ResultData<void, void>(std::in_place_index<1>) {}
-
-            constexpr inline ResultDataWrapper(ResultDataWrapper&& other
-            ) noexcept(std::is_nothrow_move_constructible_v<ResultData<void, void>>) :
-                ResultData<void, void>(std::move(other)) {}
+            constexpr inline ResultDataWrapper(ErrContainer<void>&& err GEODE_RESULT_IMPL_ERR_SITE) :
+                ResultData<void, void>(std::in_place_index<1>) {
+                GEODE_RESULT_IMPL_REPORT_ERR(err)
+                (void)err;
+            }
 
-            constexpr inline ResultDataWrapper(ResultDataWrapper const& other
-            ) noexcept(std::is_nothrow_copy_constructible_v<ResultData<void, void>>) :
-                ResultData<void, void>(other) {}
+            constexpr ResultDataWrapper(ResultDataWrapper&&) = default;
+            constexpr ResultDataWrapper(ResultDataWrapper const&) = default;
+            constexpr ResultDataWrapper& operator=(ResultDataWrapper&&) = default;
+            constexpr ResultDataWrapper& operator=(ResultDataWrapper const&) = default;
         };
     }
 
-    template <class OkType = void, class ErrType = std::string>
+    template <class OkType = void, class ErrType = GEODE_RESULT_DEFAULT_ERROR>
     class [[nodiscard]] Result final : public impl::ResultDataWrapper<OkType, ErrType> {
     public:
         using impl::ResultDataWrapper<OkType, ErrType>::ResultDataWrapper;
 
         Result() = delete;
 
-        Result(Result const& other
-        ) noexcept(std::is_nothrow_copy_constructible_v<impl::ResultData<OkType, ErrType>>) :
-            impl::ResultDataWrapper<OkType, ErrType>(other) {}
-
-        constexpr Result(Result&& other
-        ) noexcept(std::is_nothrow_move_constructible_v<impl::ResultData<OkType, ErrType>>) :
-            impl::ResultDataWrapper<OkType, ErrType>(std::move(other)) {}
-
-        constexpr Result& operator=(Result&& other
-        ) noexcept(std::is_nothrow_move_assignable_v<impl::ResultData<OkType, ErrType>>) {
-            if (this != &other) {
-                this->m_data = std::move(other.m_data);
-            }
-
-            return *this;
-        }
+        // The special members are defaulted so that a Result of trivially copyable
+        // types is itself trivially copyable, and thus passed around in registers
+        constexpr Result(Result const&) = default;
+        constexpr Result(Result&&) = default;
+        constexpr Result& operator=(Result const&) = default;
+        constexpr Result& operator=(Result&&) = default;
+        constexpr ~Result() = default;
 
         /// @brief Returns true if the Result is Ok
         /// @return true if the Result is Ok
@@ -1278,10 +2329,10 @@ namespace geode {
         template <class OkType2, class ErrType2>
         constexpr bool operator==(Result<OkType2, ErrType2> const& other) const noexcept {
             if (this->isOk() && other.isOk()) {
-                return *std::get_if<0>(&this->m_data) == *std::get_if<0>(&other.m_data);
+                return this->m_data.ok() == other.m_data.ok();
             }
             else if (this->isErr() && other.isErr()) {
-                return *std::get_if<1>(&this->m_data) == *std::get_if<1>(&other.m_data);
+                return this->m_data.err() == other.m_data.err();
             }
             return false;
         }
@@ -1291,8 +2342,8 @@ namespace geode {
         /// @return true if the Result is Ok and the Ok value is equal
         template <class OkType2>
         constexpr bool operator==(impl::OkContainer<OkType2> const& other) const noexcept {
-            if (auto* ptr = std::get_if<0>(&this->m_data)) {
-                return *ptr == other.m_ok;
+            if (this->m_data.isOk()) {
+                return this->m_data.ok() == other.m_ok;
             }
             return false;
         }
@@ -1302,8 +2353,8 @@ namespace geode {
         /// @return true if the Result is Err and the Err value is equal
         template <class ErrType2>
         constexpr bool operator==(impl::ErrContainer<ErrType2> const& other) const noexcept {
-            if (auto* ptr = std::get_if<1>(&this->m_data)) {
-                return *ptr == other.m_err;
+            if (!this->m_data.isOk()) {
+                return this->m_data.err() == other.m_err;
             }
             return false;
         }
@@ -1449,7 +2500,7 @@ namespace geode {
                 return Ok(operation(std::move(*this).unwrap()));
             }
             else {
-                return (*this).asErr();
+                return std::move(*this).asErr();
             }
         }
 
@@ -1479,7 +2530,7 @@ namespace geode {
                 return Ok(operation());
             }
             else {
-                return (*this).asErr();
+                return std::move(*this).asErr();
             }
         }
 
@@ -1610,7 +2661,7 @@ namespace geode {
                 return std::move(*this).asOk();
             }
             else {
-                return Err(operation(std::move(*this).unwrapErr()));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(operation(std::move(*this).unwrapErr())));
             }
         }
 
@@ -1625,7 +2676,7 @@ namespace geode {
                 return this->asOk();
             }
             else {
-                return Err(operation(this->unwrapErr()));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(operation(this->unwrapErr())));
             }
         }
 
@@ -1640,7 +2691,7 @@ namespace geode {
                 return std::move(*this).asOk();
             }
             else {
-                return Err(operation());
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(operation()));
             }
         }
 
@@ -1655,10 +2706,45 @@ namespace geode {
                 return this->asOk();
             }
             else {
-                return Err(operation());
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(operation()));
             }
         }
 
+        /// @brief Adds a frame of context around the Err value, turning it into a ContextError
+        /// @param frame what was being done, or an operation returning it that is
+        /// only called if the Result is Err
+        /// @return the Result, with the context added to the Err value if it is Err
+        template <class Context>
+            requires(std::constructible_from<ContextError, ErrType> && impl::ErrorContext<Context>)
+        Result<OkType, ContextError> context(Context&& frame) && {
+            if constexpr (std::same_as<ErrType, ContextError>) {
+                if (this->isErr()) [[unlikely]] {
+                    this->unwrapErr().context(impl::contextFrame(std::forward<Context>(frame)));
+                }
+                return std::move(*this);
+            }
+            else {
+                if (this->isOk()) [[likely]] {
+                    return std::move(*this).asOk();
+                }
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(ContextError(std::move(*this).unwrapErr()).context(impl::contextFrame(std::forward<Context>(frame)))));
+            }
+        }
+
+        /// @brief Adds a frame of context around the Err value, turning it into a ContextError
+        /// @param frame what was being done, or an operation returning it that is
+        /// only called if the Result is Err
+        /// @return a new Result with the Ok value if the Result is Ok, otherwise the
+        /// Err value with the context added
+        template <class Context>
+            requires(std::constructible_from<ContextError, ErrType const&> && impl::ErrorContext<Context>)
+        Result<OkType, ContextError> context(Context&& frame) const& {
+            if (this->isOk()) [[likely]] {
+                return this->asOk();
+            }
+            return GEODE_RESULT_IMPL_PROPAGATED(Err(ContextError(this->unwrapErr()).context(impl::contextFrame(std::forward<Context>(frame)))));
+        }
+
         /// @brief Inspects the Ok value with an operation
         /// @param operation the operation to call the Ok value with
         /// @return the Result itself
@@ -1690,7 +2776,7 @@ namespace geode {
                 return std::move(other);
             }
             else {
-                return (*this).asErr();
+                return std::move(*this).asErr();
             }
         }
 
@@ -1718,7 +2804,7 @@ namespace geode {
                 return operation(std::move(*this).unwrap());
             }
             else {
-                return (*this).asErr();
+                return std::move(*this).asErr();
             }
         }
 
@@ -1748,7 +2834,7 @@ namespace geode {
                 return operation();
             }
             else {
-                return (*this).asErr();
+                return std::move(*this).asErr();
             }
         }
 
@@ -1861,7 +2947,7 @@ namespace geode {
             requires(impl::IsOptional<OkType>)
         {
             if (this->isOk()) {
-                auto res = (*this).unwrap();
+                auto&& res = std::move(*this).unwrap();
                 if (res.has_value()) {
                     return Ok(std::move(res).value());
                 }
@@ -1973,11 +3059,11 @@ namespace geode {
 
         template <class OkType, class ErrType>
         constexpr Result<OkType&, ErrType&> ResultData<OkType, ErrType>::asRef() noexcept {
-            if (auto* ptr = std::get_if<0>(&m_data)) {
-                return Ok(*ptr);
+            if (m_data.isOk()) {
+                return Ok(m_data.ok());
             }
             else {
-                return Err(*std::get_if<1>(&m_data));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
         }
 
@@ -1987,17 +3073,17 @@ namespace geode {
                 return Ok();
             }
             else {
-                return Err(*std::get_if<1>(&m_data));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
         }
 
         template <class OkType>
         constexpr Result<OkType&, void> ResultData<OkType, void>::asRef() noexcept {
-            if (auto* ptr = std::get_if<0>(&m_data)) {
-                return Ok(*ptr);
+            if (m_data.isOk()) {
+                return Ok(m_data.ok());
             }
             else {
-                return Err();
+                return GEODE_RESULT_IMPL_PROPAGATED(Err());
             }
         }
 
@@ -2006,18 +3092,18 @@ namespace geode {
                 return Ok();
             }
             else {
-                return Err();
+                return GEODE_RESULT_IMPL_PROPAGATED(Err());
             }
         }
 
         template <class OkType, class ErrType>
         constexpr Result<OkType const&, ErrType const&> ResultData<OkType, ErrType>::asConst(
         ) const noexcept {
-            if (auto* ptr = std::get_if<0>(&m_data)) {
-                return Ok(*ptr);
+            if (m_data.isOk()) {
+                return Ok(m_data.ok());
             }
             else {
-                return Err(*std::get_if<1>(&m_data));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
         }
 
@@ -2027,17 +3113,17 @@ namespace geode {
                 return Ok();
             }
             else {
-                return Err(*std::get_if<1>(&m_data));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
         }
 
         template <class OkType>
         constexpr Result<OkType const&, void> ResultData<OkType, void>::asConst() const noexcept {
-            if (auto* ptr = std::get_if<0>(&m_data)) {
-                return Ok(*ptr);
+            if (m_data.isOk()) {
+                return Ok(m_data.ok());
             }
             else {
-                return Err();
+                return GEODE_RESULT_IMPL_PROPAGATED(Err());
             }
         }
 
@@ -2046,7 +3132,7 @@ namespace geode {
                 return Ok();
             }
             else {
-                return Err();
+                return GEODE_RESULT_IMPL_PROPAGATED(Err());
             }
         }
 
@@ -2055,11 +3141,11 @@ namespace geode {
         ) const noexcept(std::is_nothrow_copy_constructible_v<OkType>)
             requires(std::is_reference_v<OkType>)
         {
-            if (auto* ptr = std::get_if<0>(&m_data)) {
-                return Ok(ptr->get());
+            if (m_data.isOk()) {
+                return Ok(m_data.ok());
             }
             else {
-                return Err(*std::get_if<1>(&m_data));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
         }
 
@@ -2069,7 +3155,7 @@ namespace geode {
                 return Ok();
             }
             else {
-                return Err(*std::get_if<1>(&m_data));
+                return GEODE_RESULT_IMPL_PROPAGATED(Err(m_data.err()));
             }
         }
 
@@ -2078,11 +3164,11 @@ namespace geode {
             noexcept(std::is_nothrow_copy_constructible_v<OkType>)
             requires(std::is_reference_v<OkType>)
         {
-            if (auto* ptr = std::get_if<0>(&m_data)) {
-                return Ok(ptr->get());
+            if (m_data.isOk()) {
+                return Ok(m_data.ok());
             }
             else {
-                return Err();
+                return GEODE_RESULT_IMPL_PROPAGATED(Err());
             }
         }
 
@@ -2091,7 +3177,7 @@ namespace geode {
                 return Ok();
             }
             else {
-                return Err();
+                return GEODE_RESULT_IMPL_PROPAGATED(Err());
             }
         }
     }
@@ -0,0 +1,76 @@
+#ifndef GEODE_RESULT_ARENA_HPP
+#define GEODE_RESULT_ARENA_HPP
+
+#include "../Result.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
+namespace geode {
+    /// @brief A bump allocator for error payloads, released all at once
+    /// @note While a Scope is active, every geode::Error message and
+    /// geode::ContextError frame created on that thread is allocated from the
+    /// arena instead of the global allocator, so a burst of failures never
+    /// contends on it. Errors allocated from an arena must not outlive it or be
+    /// used after release()
+    class ErrorArena final {
+    protected:
+        std::pmr::monotonic_buffer_resource m_resource;
+
+    public:
+        /// @brief Makes a memory resource the one errors are allocated from on the
+        /// current thread, until the Scope is destroyed
+        class Scope final {
+        protected:
+            std::pmr::memory_resource* m_previous;
+
+        public:
+            explicit Scope(std::pmr::memory_resource* resource) noexcept :
+                m_previous(std::exchange(impl::errorResource(), resource)) {}
+
+            explicit Scope(ErrorArena& arena) noexcept : Scope(arena.resource()) {}
+
+            Scope(Scope const&) = delete;
+            Scope& operator=(Scope const&) = delete;
+
+            ~Scope() {
+                impl::errorResource() = m_previous;
+            }
+        };
+
+        /// @brief Constructs an arena that allocates blocks from the global allocator
+        ErrorArena() = default;
+
+        /// @brief Constructs an arena whose first block has a given size
+        explicit ErrorArena(std::size_t initialSize) : m_resource(initialSize) {}
+
+        /// @brief Constructs an arena that uses a buffer before allocating blocks
+        /// @param buffer the buffer, which must outlive the arena
+        /// @param size the size of the buffer in bytes
+        ErrorArena(void* buffer, std::size_t size) : m_resource(buffer, size) {}
+
+        ErrorArena(ErrorArena const&) = delete;
+        ErrorArena& operator=(ErrorArena const&) = delete;
+
+        /// @brief Returns the memory resource of the arena, to also allocate
+        /// other error types such as std::pmr::string from it
+        std::pmr::memory_resource* resource() noexcept {
+            return &m_resource;
+        }
+
+        /// @brief Frees every error allocated from the arena at once
+        /// @note No error allocated from the arena may be alive
+        void release() {
+            m_resource.release();
+        }
+
+        /// @brief Returns the memory resource errors are allocated from on the
+        /// current thread, null for the global allocator
+        static std::pmr::memory_resource* current() noexcept {
+            return impl::errorResource();
+        }
+    };
+}
+
+#endif
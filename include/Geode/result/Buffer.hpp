@@ -0,0 +1,242 @@
+#ifndef GEODE_RESULT_BUFFER_HPP
+#define GEODE_RESULT_BUFFER_HPP
+
+#include "../Result.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace geode {
+    /// @brief A sequence of Results stored as separate arrays: the Ok values, the
+    /// Err values, and a bitmap of which elements are Ok
+    /// @note Bulk queries only touch the bitmap, one bit per element, and the Ok
+    /// and Err values are each contiguous and in order
+    template <class OkType, class ErrType = GEODE_RESULT_DEFAULT_ERROR>
+        requires(!std::is_reference_v<OkType> && !std::is_reference_v<ErrType> &&
+                 !std::is_void_v<OkType> && !std::is_void_v<ErrType> &&
+                 !std::is_same_v<OkType, bool> && !std::is_same_v<ErrType, bool>)
+    class ResultBuffer final {
+    protected:
+        using Word = std::uint64_t;
+        static constexpr std::size_t WordBits = 64;
+
+        std::vector<OkType> m_oks;
+        std::vector<ErrType> m_errs;
+        // bit i of word i / 64 is set when element i is Ok
+        std::vector<Word> m_bits;
+        // number of Oks before each word of m_bits
+        std::vector<std::size_t> m_ranks;
+
+        /// @brief Makes room in the bitmap for one more element, done before the
+        /// element is constructed so that a throwing constructor leaves the
+        /// buffer unchanged
+        constexpr void reserveBit() {
+            if (m_bits.size() * WordBits == this->size()) {
+                m_ranks.reserve(m_bits.size() + 1);
+                m_bits.push_back(0);
+                m_ranks.push_back(m_oks.size());
+            }
+        }
+
+        /// @brief Returns the number of Oks before index
+        constexpr std::size_t okRank(std::size_t index) const noexcept {
+            auto word = index / WordBits;
+            auto below = (Word(1) << (index % WordBits)) - 1;
+            return m_ranks[word] + static_cast<std::size_t>(std::popcount(m_bits[word] & below));
+        }
+
+        /// @brief Returns the number of Oks in [from, to)
+        constexpr std::size_t countOkIn(std::size_t from, std::size_t to) const noexcept {
+            to = std::min(to, this->size());
+            if (from >= to) {
+                return 0;
+            }
+            auto count = to < this->size() ? this->okRank(to) : m_oks.size();
+            return count - this->okRank(from);
+        }
+
+    public:
+        constexpr ResultBuffer() noexcept = default;
+
+        /// @brief Reserves space for a number of elements
+        /// @param oks the number of Ok values to reserve space for
+        /// @param errs the number of Err values to reserve space for
+        constexpr void reserve(std::size_t oks, std::size_t errs = 0) {
+            m_oks.reserve(oks);
+            m_errs.reserve(errs);
+            auto words = (oks + errs + WordBits - 1) / WordBits;
+            m_bits.reserve(words);
+            m_ranks.reserve(words);
+        }
+
+        /// @brief Returns the number of elements
+        constexpr std::size_t size() const noexcept {
+            return m_oks.size() + m_errs.size();
+        }
+
+        /// @brief Returns true if there are no elements
+        constexpr bool empty() const noexcept {
+            return this->size() == 0;
+        }
+
+        /// @brief Removes every element
+        constexpr void clear() noexcept {
+            m_oks.clear();
+            m_errs.clear();
+            m_bits.clear();
+            m_ranks.clear();
+        }
+
+        /// @brief Appends an Ok value constructed in place
+        /// @return a reference to the new Ok value
+        template <class... Args>
+        constexpr OkType& pushOk(Args&&... args) {
+            this->reserveBit();
+            auto& value = m_oks.emplace_back(std::forward<Args>(args)...);
+            auto index = this->size() - 1;
+            m_bits[index / WordBits] |= Word(1) << (index % WordBits);
+            return value;
+        }
+
+        /// @brief Appends an Err value constructed in place
+        /// @return a reference to the new Err value
+        template <class... Args>
+        constexpr ErrType& pushErr(Args&&... args) {
+            this->reserveBit();
+            return m_errs.emplace_back(std::forward<Args>(args)...);
+        }
+
+        /// @brief Appends the value of a Result
+        template <class Res>
+            requires std::same_as<std::remove_cvref_t<Res>, Result<OkType, ErrType>>
+        constexpr void push(Res&& result) {
+            if (result.isOk()) {
+                this->pushOk(std::forward<Res>(result).unwrap());
+            }
+            else {
+                this->pushErr(std::forward<Res>(result).unwrapErr());
+            }
+        }
+
+        /// @brief Returns true if the element at index is Ok
+        constexpr bool isOk(std::size_t index) const noexcept {
+            return (m_bits[index / WordBits] >> (index % WordBits)) & 1;
+        }
+
+        /// @brief Returns true if the element at index is Err
+        constexpr bool isErr(std::size_t index) const noexcept {
+            return !this->isOk(index);
+        }
+
+        /// @brief Returns a Result with references to the element at index
+        constexpr Result<OkType&, ErrType&> at(std::size_t index) noexcept {
+            auto rank = this->okRank(index);
+            if (this->isOk(index)) {
+                return Ok(m_oks[rank]);
+            }
+            return GEODE_RESULT_IMPL_PROPAGATED(Err(m_errs[index - rank]));
+        }
+
+        /// @brief Returns a Result with const references to the element at index
+        constexpr Result<OkType const&, ErrType const&> at(std::size_t index) const noexcept {
+            auto rank = this->okRank(index);
+            if (this->isOk(index)) {
+                return Ok(m_oks[rank]);
+            }
+            return GEODE_RESULT_IMPL_PROPAGATED(Err(m_errs[index - rank]));
+        }
+
+        constexpr Result<OkType&, ErrType&> operator[](std::size_t index) noexcept {
+            return this->at(index);
+        }
+
+        constexpr Result<OkType const&, ErrType const&> operator[](std::size_t index) const noexcept {
+            return this->at(index);
+        }
+
+        /// @brief Returns the number of Ok elements
+        constexpr std::size_t countOk() const noexcept {
+            return m_oks.size();
+        }
+
+        /// @brief Returns the number of Err elements
+        constexpr std::size_t countErr() const noexcept {
+            return m_errs.size();
+        }
+
+        /// @brief Returns the number of Ok elements in [from, to), counted from the bitmap
+        constexpr std::size_t countOk(std::size_t from, std::size_t to) const noexcept {
+            return this->countOkIn(from, to);
+        }
+
+        /// @brief Returns the number of Err elements in [from, to), counted from the bitmap
+        constexpr std::size_t countErr(std::size_t from, std::size_t to) const noexcept {
+            to = std::min(to, this->size());
+            return from < to ? to - from - this->countOkIn(from, to) : 0;
+        }
+
+        /// @brief Returns true if every element is Ok
+        constexpr bool allOk() const noexcept {
+            return m_errs.empty();
+        }
+
+        /// @brief Returns the index of the first Err element, if there is one
+        constexpr std::optional<std::size_t> firstErr() const noexcept {
+            if (m_errs.empty()) {
+                return std::nullopt;
+            }
+            for (std::size_t word = 0; word < m_bits.size(); ++word) {
+                // bits past the end are 0, so the word with the last element
+                // always has a zero where the first Err or the end is
+                auto errs = ~m_bits[word];
+                if (errs != 0) {
+                    return word * WordBits + static_cast<std::size_t>(std::countr_zero(errs));
+                }
+            }
+            return std::nullopt;
+        }
+
+        /// @brief Returns every Ok value, in order
+        constexpr std::span<OkType> compactOks() & noexcept {
+            return m_oks;
+        }
+
+        /// @brief Returns every Ok value, in order
+        constexpr std::span<OkType const> compactOks() const& noexcept {
+            return m_oks;
+        }
+
+        /// @brief Moves every Ok value out of the buffer, in order, clearing it
+        constexpr std::vector<OkType> compactOks() && noexcept {
+            auto oks = std::move(m_oks);
+            this->clear();
+            return oks;
+        }
+
+        /// @brief Returns every Err value, in order
+        constexpr std::span<ErrType> compactErrs() & noexcept {
+            return m_errs;
+        }
+
+        /// @brief Returns every Err value, in order
+        constexpr std::span<ErrType const> compactErrs() const& noexcept {
+            return m_errs;
+        }
+
+        /// @brief Moves every Err value out of the buffer, in order, clearing it
+        constexpr std::vector<ErrType> compactErrs() && noexcept {
+            auto errs = std::move(m_errs);
+            this->clear();
+            return errs;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef GEODE_RESULT_COROUTINE_HPP
+#define GEODE_RESULT_COROUTINE_HPP
+
+#include "../Result.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#if !defined(GEODE_RESULT_FRAME_ARENA_SIZE)
+    // Size in bytes of the per thread buffer that Result coroutine frames are
+    // allocated from, frames that do not fit go to the heap. Define as 0 to
+    // always allocate frames on the heap
+    #define GEODE_RESULT_FRAME_ARENA_SIZE 16384
+#endif
+
+#if !defined(GEODE_RESULT_IMPL_RAMP_DESTROYS_FRAME)
+    // GCC destroys the frame of a coroutine when an exception leaves the call to
+    // it, even once the coroutine is suspended, other compilers leave that to
+    // whoever holds its handle
+    #if defined(__GNUC__) && !defined(__clang__)
+        #define GEODE_RESULT_IMPL_RAMP_DESTROYS_FRAME 1
+    #else
+        #define GEODE_RESULT_IMPL_RAMP_DESTROYS_FRAME 0
+    #endif
+#endif
+
+namespace geode {
+    namespace impl {
+        /// @brief Thread local stack of Result coroutine frames
+        /// @note Result coroutines never stay suspended, every frame is destroyed
+        /// before its coroutine returns to the caller, so frames are always freed
+        /// in the reverse order of their allocation
+        class ResultFrameArena {
+            static constexpr std::size_t Alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+            static constexpr std::size_t Capacity = GEODE_RESULT_FRAME_ARENA_SIZE;
+
+            alignas(Alignment) std::byte m_buffer[Capacity > 0 ? Capacity : 1] = {};
+            std::size_t m_top = 0;
+            std::size_t m_frames = 0;
+
+            bool contains(void* ptr) const noexcept {
+                auto bytes = static_cast<std::byte const*>(ptr);
+                return bytes >= m_buffer && bytes < m_buffer + Capacity;
+            }
+
+        public:
+            constexpr ResultFrameArena() noexcept = default;
+
+            ResultFrameArena(ResultFrameArena const&) = delete;
+            ResultFrameArena& operator=(ResultFrameArena const&) = delete;
+
+            /// @brief Returns the arena of the current thread
+            static ResultFrameArena& current() noexcept {
+                static thread_local constinit ResultFrameArena arena;
+                return arena;
+            }
+
+            void* allocate(std::size_t size) {
+                ++m_frames;
+                auto rounded = (size + Alignment - 1) & ~(Alignment - 1);
+                if (Capacity - m_top >= rounded) {
+                    auto ptr = m_buffer + m_top;
+                    m_top += rounded;
+                    return ptr;
+                }
+                return ::operator new(size);
+            }
+
+            void deallocate(void* ptr, std::size_t size) noexcept {
+                --m_frames;
+                if (this->contains(ptr)) {
+                    m_top = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - m_buffer);
+                }
+                else {
+                    ::operator delete(ptr, size);
+                }
+            }
+
+            /// @brief Returns the number of bytes currently in use
+            std::size_t used() const noexcept {
+                return m_top;
+            }
+
+            /// @brief Returns the number of frames allocated and not freed yet,
+            /// whether they are in the arena or on the heap
+            std::size_t frames() const noexcept {
+                return m_frames;
+            }
+        };
+
+        template <class ResultRef>
+        class ResultAwaiter;
+
+        /// @brief Promise type of coroutines returning a Result
+        /// @note The ReturnObject is converted to the Result once the coroutine
+        /// has finished, which relies on the compiler initializing the return
+        /// value when the coroutine first returns to its caller rather than right
+        /// after get_return_object (CWG2563). GCC 10+, Clang 17+ and MSVC do so
+        /// when the two types differ. Compilers converting eagerly are detected
+        /// and terminate, instead of writing through a dangling pointer
+        template <class OkType, class ErrType>
+        class ResultPromise {
+        public:
+            using ResultType = Result<OkType, ErrType>;
+
+            /// @brief Object returned to the caller of the coroutine, converted to
+            /// the Result once the coroutine has finished
+            class ReturnObject {
+            protected:
+                std::optional<ResultType> m_result;
+                std::coroutine_handle<ResultPromise> m_handle;
+
+                friend class ResultPromise;
+
+            public:
+                explicit ReturnObject(ResultPromise& promise) noexcept :
+                    m_handle(std::coroutine_handle<ResultPromise>::from_promise(promise)) {
+                    promise.m_return = this;
+                }
+
+                ReturnObject(ReturnObject const&) = delete;
+                ReturnObject& operator=(ReturnObject const&) = delete;
+
+                operator ResultType() {
+                    if (m_result) [[likely]] {
+                        return std::move(*m_result);
+                    }
+#if __cpp_exceptions
+                    // the coroutine is kept suspended at its final suspend point
+                    // so that the exception can be read
+                    if (auto exception = std::exchange(m_handle.promise().m_exception, nullptr)) {
+#if !GEODE_RESULT_IMPL_RAMP_DESTROYS_FRAME
+                        m_handle.destroy();
+#endif
+                        std::rethrow_exception(std::move(exception));
+                    }
+#endif
+                    // converted before the body ran, see the note on ResultPromise
+                    std::terminate();
+                }
+            };
+
+            /// @brief Finishes the coroutine, keeping it suspended only if it
+            /// ended with an exception, which the ReturnObject still has to read
+            class FinalAwaiter {
+            protected:
+                bool m_ready;
+
+            public:
+                explicit FinalAwaiter(bool ready) noexcept : m_ready(ready) {}
+
+                bool await_ready() const noexcept {
+                    return m_ready;
+                }
+
+                void await_suspend(std::coroutine_handle<>) const noexcept {}
+
+                void await_resume() const noexcept {}
+            };
+
+        protected:
+            ReturnObject* m_return = nullptr;
+#if __cpp_exceptions
+            std::exception_ptr m_exception;
+#endif
+
+        public:
+            ReturnObject get_return_object() noexcept {
+                return ReturnObject(*this);
+            }
+
+            std::suspend_never initial_suspend() const noexcept {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept {
+#if __cpp_exceptions
+                return FinalAwaiter(!m_exception);
+#else
+                return FinalAwaiter(true);
+#endif
+            }
+
+            template <class Value>
+                requires std::is_constructible_v<ResultType, Value&&>
+            void return_value(Value&& value) {
+                m_return->m_result.emplace(std::forward<Value>(value));
+            }
+
+            /// @brief Keeps the exception, which the ReturnObject rethrows once the
+            /// coroutine has finished
+            void unhandled_exception() noexcept {
+#if __cpp_exceptions
+                m_exception = std::current_exception();
+#else
+                std::terminate();
+#endif
+            }
+
+            /// @brief Only Results can be awaited in a Result coroutine, since
+            /// anything else could leave the coroutine suspended
+            template <class Awaited>
+                requires IsResult<std::remove_cvref_t<Awaited>>
+            ResultAwaiter<Awaited&&> await_transform(Awaited&& result) noexcept {
+                return ResultAwaiter<Awaited&&>(std::forward<Awaited>(result));
+            }
+
+            static void* operator new(std::size_t size) {
+                return ResultFrameArena::current().allocate(size);
+            }
+
+            static void operator delete(void* ptr, std::size_t size) noexcept {
+                ResultFrameArena::current().deallocate(ptr, size);
+            }
+        };
+
+        /// @brief Unwraps an awaited Result, or finishes the awaiting coroutine
+        /// with its Err
+        template <class ResultRef>
+        class ResultAwaiter {
+        protected:
+            ResultRef m_result;
+
+        public:
+            explicit ResultAwaiter(ResultRef result) noexcept :
+                m_result(std::forward<ResultRef>(result)) {}
+
+            bool await_ready() const noexcept {
+                return m_result.isOk();
+            }
+
+            template <class Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) {
+                handle.promise().return_value(std::forward<ResultRef>(m_result).asErr());
+                handle.destroy();
+            }
+
+            decltype(auto) await_resume() {
+                return std::forward<ResultRef>(m_result).unwrap();
+            }
+        };
+    }
+}
+
+/// @brief Makes any Result usable as the return type of a coroutine, in which
+/// `co_await` unwraps a Result or returns its Err from the coroutine
+template <class OkType, class ErrType, class... Args>
+struct std::coroutine_traits<geode::Result<OkType, ErrType>, Args...> {
+    using promise_type = geode::impl::ResultPromise<OkType, ErrType>;
+};
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef GEODE_RESULT_EXPECTED_HPP
+#define GEODE_RESULT_EXPECTED_HPP
+
+#include "../Result.hpp"
+
+#include <version>
+
+#if __cpp_lib_expected >= 202202L
+    #include <expected>
+
+namespace geode {
+    namespace impl {
+        // std::expected cannot hold references or a void error, so they are
+        // stored as std::reference_wrapper and std::monostate
+        template <class Type>
+        struct ExpectedValueImpl {
+            using type = Type;
+        };
+
+        template <class Type>
+        struct ExpectedValueImpl<Type&> {
+            using type = std::reference_wrapper<Type>;
+        };
+
+        template <class Type>
+        struct ExpectedErrorImpl : ExpectedValueImpl<Type> {};
+
+        template <>
+        struct ExpectedErrorImpl<void> {
+            using type = std::monostate;
+        };
+
+        template <class OkType, class ErrType>
+        using ExpectedFor =
+            std::expected<typename ExpectedValueImpl<OkType>::type, typename ExpectedErrorImpl<ErrType>::type>;
+
+        template <class Type>
+        struct IsExpectedImpl : std::false_type {};
+
+        template <class ValueType, class ErrorType>
+        struct IsExpectedImpl<std::expected<ValueType, ErrorType>> : std::true_type {};
+
+        template <class Type>
+        concept IsExpected = IsExpectedImpl<std::remove_cvref_t<Type>>::value;
+
+        template <class ValueType, class ErrorType>
+        constexpr bool unwrapIsErr(std::expected<ValueType, ErrorType> const& expected) noexcept {
+            return !expected.has_value();
+        }
+
+        template <class Expected>
+            requires IsExpected<Expected>
+        constexpr auto unwrapErr(Expected&& expected) {
+            return GEODE_RESULT_IMPL_PROPAGATED(Err(std::forward<Expected>(expected).error()));
+        }
+
+        template <class Expected>
+            requires IsExpected<Expected>
+        constexpr decltype(auto) unwrapOk(Expected&& expected) {
+            return *std::forward<Expected>(expected);
+        }
+
+        template <class OkType, class ErrType, class Source>
+        constexpr ExpectedFor<OkType, ErrType> toExpected(Source&& result) {
+            using Expected = ExpectedFor<OkType, ErrType>;
+            if (result.isOk()) {
+                if constexpr (std::is_void_v<OkType>) {
+                    return Expected();
+                }
+                else {
+                    return Expected(std::in_place, std::forward<Source>(result).unwrap());
+                }
+            }
+            if constexpr (std::is_void_v<ErrType>) {
+                return Expected(std::unexpect);
+            }
+            else {
+                return Expected(std::unexpect, std::forward<Source>(result).unwrapErr());
+            }
+        }
+
+        template <class OkType, class ErrType, class Source>
+        constexpr Result<OkType, ErrType> fromExpected(Source&& expected) {
+            if (expected.has_value()) {
+                if constexpr (std::is_void_v<OkType>) {
+                    return Result<OkType, ErrType>(std::in_place_index<0>);
+                }
+                else {
+                    return Result<OkType, ErrType>(std::in_place_index<0>, *std::forward<Source>(expected));
+                }
+            }
+            return Result<OkType, ErrType>(std::in_place_index<1>, std::forward<Source>(expected).error());
+        }
+    }
+
+    /// @brief Converts a Result into a std::expected, moving the value into place
+    /// @note References are held as std::reference_wrapper, and a void Err
+    /// becomes std::monostate
+    /// @return a std::expected with the Ok value, or the Err value as unexpected
+    template <class OkType, class ErrType>
+    constexpr impl::ExpectedFor<OkType, ErrType> toExpected(Result<OkType, ErrType>&& result) noexcept(
+        std::is_nothrow_move_constructible_v<impl::ExpectedFor<OkType, ErrType>>
+    ) {
+        return impl::toExpected<OkType, ErrType>(std::move(result));
+    }
+
+    /// @brief Converts a Result into a std::expected, copying the value
+    /// @return a std::expected with the Ok value, or the Err value as unexpected
+    template <class OkType, class ErrType>
+    constexpr impl::ExpectedFor<OkType, ErrType> toExpected(Result<OkType, ErrType> const& result) noexcept(
+        std::is_nothrow_copy_constructible_v<impl::ExpectedFor<OkType, ErrType>>
+    ) {
+        return impl::toExpected<OkType, ErrType>(result);
+    }
+
+    /// @brief Converts a std::expected into a Result, moving the value into place
+    /// @return an Ok Result with the value, or an Err Result with the error
+    template <class ValueType, class ErrorType>
+    constexpr Result<ValueType, ErrorType> fromExpected(std::expected<ValueType, ErrorType>&& expected) noexcept(
+        std::is_nothrow_move_constructible_v<std::expected<ValueType, ErrorType>>
+    ) {
+        return impl::fromExpected<ValueType, ErrorType>(std::move(expected));
+    }
+
+    /// @brief Converts a std::expected into a Result, copying the value
+    /// @return an Ok Result with the value, or an Err Result with the error
+    template <class ValueType, class ErrorType>
+    constexpr Result<ValueType, ErrorType> fromExpected(std::expected<ValueType, ErrorType> const& expected) noexcept(
+        std::is_nothrow_copy_constructible_v<std::expected<ValueType, ErrorType>>
+    ) {
+        return impl::fromExpected<ValueType, ErrorType>(expected);
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef GEODE_RESULT_INSTRUMENTATION_HPP
+#define GEODE_RESULT_INSTRUMENTATION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+#if !defined(GEODE_RESULT_INSTRUMENTATION_SITES)
+    // The number of distinct call sites that can be counted, must be a power of two.
+    // Errs from sites past that are only counted in dropped()
+    #define GEODE_RESULT_INSTRUMENTATION_SITES 4096
+#endif
+
+namespace geode::instrumentation {
+    /// @brief How many times an Err was created at a call site
+    struct ErrSite {
+        char const* file;
+        char const* function;
+        std::uint32_t line;
+        std::uint32_t column;
+        std::uint64_t count;
+    };
+
+    namespace impl {
+        static_assert(
+            (GEODE_RESULT_INSTRUMENTATION_SITES & (GEODE_RESULT_INSTRUMENTATION_SITES - 1)) == 0,
+            "GEODE_RESULT_INSTRUMENTATION_SITES must be a power of two"
+        );
+
+        // Probing stops after this many taken slots, so that a full table costs a
+        // bounded amount per Err
+        inline constexpr std::size_t MaxProbes = 64;
+
+        struct SiteSlot {
+            // hash of the location, 0 while the slot is free
+            std::atomic<std::uint64_t> key = 0;
+            // set once the location below has been written by the thread that took the slot
+            std::atomic<bool> ready = false;
+            char const* file = nullptr;
+            char const* function = nullptr;
+            std::uint32_t line = 0;
+            std::uint32_t column = 0;
+            std::atomic<std::uint64_t> count = 0;
+        };
+
+        struct SiteTable {
+            SiteSlot slots[GEODE_RESULT_INSTRUMENTATION_SITES];
+            std::atomic<std::uint64_t> dropped = 0;
+        };
+
+        inline constinit SiteTable siteTable{};
+
+        constexpr std::uint64_t hashSite(std::source_location const& location) noexcept {
+            // FNV-1a over the file name, then the line and column
+            std::uint64_t hash = 0xcbf29ce484222325ull;
+            auto mix = [&](std::uint64_t byte) {
+                hash = (hash ^ byte) * 0x100000001b3ull;
+            };
+            for (char const* c = location.file_name(); *c; ++c) {
+                mix(static_cast<unsigned char>(*c));
+            }
+            for (std::uint32_t value : {location.line(), location.column()}) {
+                for (int shift = 0; shift < 32; shift += 8) {
+                    mix((value >> shift) & 0xff);
+                }
+            }
+            return hash == 0 ? 1 : hash;
+        }
+    }
+
+    /// @brief Counts an Err created at a call site
+    /// @note Lock-free, and only takes relaxed atomics once the site has been
+    /// seen before. This is what GEODE_RESULT_ON_ERR calls when
+    /// GEODE_RESULT_INSTRUMENTATION is defined
+    inline void recordErr(std::source_location const& location) noexcept {
+        auto& table = impl::siteTable;
+        std::uint64_t const key = impl::hashSite(location);
+        std::size_t index = key & (GEODE_RESULT_INSTRUMENTATION_SITES - 1);
+        for (std::size_t probe = 0; probe < impl::MaxProbes; ++probe) {
+            auto& slot = table.slots[index];
+            std::uint64_t current = slot.key.load(std::memory_order_acquire);
+            if (current == 0) {
+                if (slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+                    slot.file = location.file_name();
+                    slot.function = location.function_name();
+                    slot.line = location.line();
+                    slot.column = location.column();
+                    slot.ready.store(true, std::memory_order_release);
+                    current = key;
+                }
+            }
+            if (current == key) {
+                slot.count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            index = (index + 1) & (GEODE_RESULT_INSTRUMENTATION_SITES - 1);
+        }
+        table.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Returns every call site that created an Err, most frequent first
+    /// @note Counts from other threads may be in flight while taking the snapshot
+    inline std::vector<ErrSite> sites() {
+        std::vector<ErrSite> result;
+        for (auto& slot : impl::siteTable.slots) {
+            if (!slot.ready.load(std::memory_order_acquire)) {
+                continue;
+            }
+            std::uint64_t count = slot.count.load(std::memory_order_relaxed);
+            if (count != 0) {
+                result.push_back({slot.file, slot.function, slot.line, slot.column, count});
+            }
+        }
+        std::ranges::stable_sort(result, std::ranges::greater{}, &ErrSite::count);
+        return result;
+    }
+
+    /// @brief Returns the number of Errs created across all call sites
+    inline std::uint64_t total() noexcept {
+        std::uint64_t sum = impl::siteTable.dropped.load(std::memory_order_relaxed);
+        for (auto& slot : impl::siteTable.slots) {
+            sum += slot.count.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    /// @brief Returns the number of Errs that could not be given a site because
+    /// the table was full
+    inline std::uint64_t dropped() noexcept {
+        return impl::siteTable.dropped.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Sets every count back to zero, keeping the sites seen so far
+    inline void reset() noexcept {
+        for (auto& slot : impl::siteTable.slots) {
+            slot.count.store(0, std::memory_order_relaxed);
+        }
+        impl::siteTable.dropped.store(0, std::memory_order_relaxed);
+    }
+
+    /// @brief Writes one line per call site, most frequent first, as
+    /// `count file:line:column function`
+    template <class Stream>
+    Stream& dump(Stream& stream) {
+        for (auto const& site : sites()) {
+            stream << site.count << ' ' << site.file << ':' << site.line << ':' << site.column << ' '
+                   << site.function << '\n';
+        }
+        if (auto lost = dropped(); lost != 0) {
+            stream << lost << " (dropped, increase GEODE_RESULT_INSTRUMENTATION_SITES)\n";
+        }
+        return stream;
+    }
+}
+
+#endif
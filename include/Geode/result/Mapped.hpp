@@ -0,0 +1,146 @@
+#ifndef GEODE_RESULT_MAPPED_HPP
+#define GEODE_RESULT_MAPPED_HPP
+
+#include "Sys.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#if defined(GEODE_RESULT_IMPL_POSIX)
+namespace geode {
+    /// @brief Hints about how the mapping will be accessed, passed to madvise
+    struct MapAdvice {
+        /// @brief Read from start to end, so pages can be read ahead aggressively
+        bool sequential = false;
+        /// @brief Read in no particular order, so read ahead is wasted
+        bool random = false;
+        /// @brief Read soon, so reading all pages can start right away
+        bool willNeed = false;
+        /// @brief Back the mapping with huge pages where the file system supports it
+        bool hugePage = false;
+    };
+
+    /// @brief A whole file mapped read-only into memory, unmapped on destruction
+    /// @note The contents are read from the page cache as they are accessed,
+    /// instead of being copied into a buffer up front. Views returned by bytes()
+    /// and text() are valid as long as the MappedFile
+    class MappedFile final {
+    protected:
+        std::byte const* m_data = nullptr;
+        std::size_t m_size = 0;
+
+        constexpr MappedFile(std::byte const* data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+    public:
+        /// @brief Hints about how the mapping will be accessed
+        using Advice = MapAdvice;
+
+        /// @brief Constructs an empty MappedFile, which maps nothing
+        constexpr MappedFile() noexcept = default;
+
+        MappedFile(MappedFile const&) = delete;
+        MappedFile& operator=(MappedFile const&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept :
+            m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+        MappedFile& operator=(MappedFile&& other) noexcept {
+            if (this != &other) {
+                this->unmap();
+                m_data = std::exchange(other.m_data, nullptr);
+                m_size = std::exchange(other.m_size, 0);
+            }
+            return *this;
+        }
+
+        ~MappedFile() {
+            this->unmap();
+        }
+
+        /// @brief Maps a whole file
+        /// @param path the path of the file
+        /// @param advice hints applied to the mapping, which are ignored where
+        /// they are not supported
+        /// @return the mapped file, or the errno of opening, inspecting or mapping it
+        static Result<MappedFile, Errno> open(char const* path, Advice advice = {}) noexcept {
+            GEODE_UNWRAP_INTO(int fd, sys::open(path, O_RDONLY | O_CLOEXEC));
+            // the mapping keeps the file alive, so the descriptor is not needed anymore
+            auto mapped = MappedFile::map(fd, advice);
+            (void)sys::close(fd);
+            return mapped;
+        }
+
+        /// @brief Maps the whole file behind a file descriptor, which can be closed afterwards
+        /// @param fd the file descriptor, opened for reading
+        /// @param advice hints applied to the mapping, which are ignored where
+        /// they are not supported
+        /// @return the mapped file, or the errno of inspecting or mapping it
+        static Result<MappedFile, Errno> map(int fd, Advice advice = {}) noexcept {
+            GEODE_UNWRAP_INTO(struct stat status, sys::fstat(fd));
+            auto size = static_cast<std::size_t>(status.st_size);
+            if (size == 0) {
+                // mmap refuses empty mappings
+                return Ok(MappedFile());
+            }
+            GEODE_UNWRAP_INTO(void* data, sys::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0));
+            MappedFile file(static_cast<std::byte const*>(data), size);
+            (void)file.advise(advice);
+            return Ok(std::move(file));
+        }
+
+        /// @brief Applies hints to the mapping
+        /// @return the errno of the first hint that was rejected
+        Result<void, Errno> advise(Advice advice) const noexcept {
+            if (m_size == 0) {
+                return Ok();
+            }
+            auto apply = [&](bool enabled, int flag) -> Result<void, Errno> {
+                if (!enabled) {
+                    return Ok();
+                }
+                return sys::madvise(const_cast<std::byte*>(m_data), m_size, flag);
+            };
+            GEODE_UNWRAP(apply(advice.sequential, MADV_SEQUENTIAL));
+            GEODE_UNWRAP(apply(advice.random, MADV_RANDOM));
+            GEODE_UNWRAP(apply(advice.willNeed, MADV_WILLNEED));
+#if defined(MADV_HUGEPAGE)
+            GEODE_UNWRAP(apply(advice.hugePage, MADV_HUGEPAGE));
+#endif
+            return Ok();
+        }
+
+        /// @brief Returns the contents of the file
+        std::span<std::byte const> bytes() const noexcept {
+            return std::span<std::byte const>(m_data, m_size);
+        }
+
+        /// @brief Returns the contents of the file as characters
+        std::string_view text() const noexcept {
+            return std::string_view(reinterpret_cast<char const*>(m_data), m_size);
+        }
+
+        std::byte const* data() const noexcept {
+            return m_data;
+        }
+
+        std::size_t size() const noexcept {
+            return m_size;
+        }
+
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+    protected:
+        void unmap() noexcept {
+            if (m_data) {
+                (void)sys::munmap(const_cast<std::byte*>(m_data), m_size);
+            }
+        }
+    };
+}
+#endif
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef GEODE_RESULT_PARALLEL_HPP
+#define GEODE_RESULT_PARALLEL_HPP
+
+#include "../Result.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace geode::parallel {
+    /// @brief How the work of a parallel operation is split up
+    struct Options {
+        /// @brief Number of threads to use including the calling thread,
+        /// 0 uses std::thread::hardware_concurrency()
+        std::size_t threads = 0;
+        /// @brief Number of elements a thread takes at a time, 0 picks a size
+        /// that gives every thread several chunks
+        std::size_t chunkSize = 0;
+    };
+
+    namespace impl {
+        template <class Range, class Operation>
+        using OperationResult =
+            std::remove_cvref_t<std::invoke_result_t<Operation&, std::ranges::range_reference_t<Range>>>;
+
+        /// @brief A range that can be split between threads, and an operation
+        /// returning a Result for each of its elements
+        template <class Range, class Operation>
+        concept ResultOperation = std::ranges::random_access_range<Range> && std::ranges::sized_range<Range> &&
+            std::invocable<Operation&, std::ranges::range_reference_t<Range>> &&
+            IsResult<OperationResult<Range, Operation>> &&
+            !std::is_void_v<geode::impl::ResultErrType<OperationResult<Range, Operation>>>;
+
+        /// @brief Tracks the Err with the lowest index across threads. Once an element
+        /// fails, elements after it are skipped, but every element before it still
+        /// runs, so the reported Err is always the one a sequential loop would return
+        template <class ErrType>
+        class FirstErr {
+        protected:
+            // reference errors are stored as pointers, like ResultStorage does
+            using Stored = std::conditional_t<
+                std::is_reference_v<ErrType>, std::remove_reference_t<ErrType>*, ErrType>;
+
+            std::atomic<std::size_t> m_index;
+            std::mutex m_mutex;
+            std::optional<Stored> m_err;
+            std::exception_ptr m_exception;
+
+        public:
+            explicit FirstErr(std::size_t size) noexcept : m_index(size) {}
+
+            /// @brief Returns true if the element at index still needs to run
+            bool wanted(std::size_t index) const noexcept {
+                return index < m_index.load(std::memory_order_relaxed);
+            }
+
+            template <class Err>
+            void publish(std::size_t index, Err&& err) {
+                std::lock_guard lock(m_mutex);
+                if (index < m_index.load(std::memory_order_relaxed)) {
+                    if constexpr (std::is_reference_v<ErrType>) {
+                        m_err.emplace(std::addressof(static_cast<ErrType>(err)));
+                    }
+                    else {
+                        m_err.emplace(std::forward<Err>(err));
+                    }
+                    m_index.store(index, std::memory_order_relaxed);
+                }
+            }
+
+            void publishException(std::exception_ptr exception) {
+                std::lock_guard lock(m_mutex);
+                if (!m_exception) {
+                    m_exception = std::move(exception);
+                }
+                m_index.store(0, std::memory_order_relaxed);
+            }
+
+            /// @brief Rethrows an exception thrown by the operation, if there was one
+            void rethrow() {
+                if (m_exception) {
+                    std::rethrow_exception(m_exception);
+                }
+            }
+
+            /// @brief Returns true if an element returned Err
+            bool failed() const noexcept {
+                return m_err.has_value();
+            }
+
+            /// @brief Moves out the Err with the lowest index, once every thread is done
+            auto takeErr() {
+                if constexpr (std::is_reference_v<ErrType>) {
+                    return GEODE_RESULT_IMPL_PROPAGATED(Err(**m_err));
+                }
+                else {
+                    return GEODE_RESULT_IMPL_PROPAGATED(Err(std::move(*m_err)));
+                }
+            }
+        };
+
+        /// @brief Calls work(begin, end) for chunks of [0, size) on the given number
+        /// of threads, the calling thread being one of them
+        template <class Work>
+        void runChunks(std::size_t size, Options const& options, Work& work) {
+            auto threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+            threads = std::min(threads, std::max<std::size_t>(size, 1));
+            auto chunkSize = options.chunkSize ? options.chunkSize : std::max<std::size_t>(size / (threads * 8), 1);
+
+            std::atomic<std::size_t> next = 0;
+            auto worker = [&] {
+                while (true) {
+                    auto begin = next.fetch_add(chunkSize, std::memory_order_relaxed);
+                    if (begin >= size) {
+                        return;
+                    }
+                    work(begin, std::min(begin + chunkSize, size));
+                }
+            };
+
+            std::vector<std::jthread> pool;
+            pool.reserve(threads - 1);
+            for (std::size_t i = 1; i < threads; ++i) {
+                pool.emplace_back(worker);
+            }
+            worker();
+        }
+
+        template <class Range, class Operation, class ErrType>
+        void runOperation(Range& range, Operation& operation, Options const& options, FirstErr<ErrType>& first, auto&& onOk) {
+            auto size = static_cast<std::size_t>(std::ranges::size(range));
+            auto begin = std::ranges::begin(range);
+            auto work = [&](std::size_t from, std::size_t to) {
+#if __cpp_exceptions
+                try {
+#endif
+                    for (auto i = from; i < to && first.wanted(i); ++i) {
+                        auto res = std::invoke(operation, begin[i]);
+                        if (res.isErr()) {
+                            first.publish(i, std::move(res).unwrapErr());
+                            return;
+                        }
+                        onOk(i, std::move(res));
+                    }
+#if __cpp_exceptions
+                }
+                catch (...) {
+                    first.publishException(std::current_exception());
+                }
+#endif
+            };
+            runChunks(size, options, work);
+            first.rethrow();
+        }
+    }
+
+    /// @brief Calls an operation returning a Result on every element of a range,
+    /// spread over several threads, stopping early once an element fails
+    /// @param range the elements, which must be random access and sized
+    /// @param operation the operation, called concurrently from several threads
+    /// @param options how to split the work between threads
+    /// @return Ok, or the Err of the first element that failed
+    template <class Range, class Operation>
+        requires impl::ResultOperation<Range, Operation>
+    Result<void, geode::impl::ResultErrType<impl::OperationResult<Range, Operation>>> tryForEach(
+        Range&& range, Operation operation, Options const& options = {}
+    ) {
+        using ErrType = geode::impl::ResultErrType<impl::OperationResult<Range, Operation>>;
+
+        impl::FirstErr<ErrType> first(static_cast<std::size_t>(std::ranges::size(range)));
+        impl::runOperation(range, operation, options, first, [](std::size_t, auto&&) {});
+        if (first.failed()) {
+            return first.takeErr();
+        }
+        return Ok();
+    }
+
+    /// @brief Maps every element of a range with an operation returning a Result,
+    /// spread over several threads, stopping early once an element fails
+    /// @param range the elements, which must be random access and sized
+    /// @param operation the operation, called concurrently from several threads
+    /// @param options how to split the work between threads
+    /// @return the mapped Ok values in the order of the range, or the Err of the
+    /// first element that failed
+    template <class Range, class Operation>
+        requires impl::ResultOperation<Range, Operation> &&
+        (!std::is_void_v<geode::impl::ResultOkType<impl::OperationResult<Range, Operation>>>)
+    Result<
+        std::vector<std::remove_cvref_t<geode::impl::ResultOkType<impl::OperationResult<Range, Operation>>>>,
+        geode::impl::ResultErrType<impl::OperationResult<Range, Operation>>>
+    tryTransform(Range&& range, Operation operation, Options const& options = {}) {
+        using OkType = std::remove_cvref_t<geode::impl::ResultOkType<impl::OperationResult<Range, Operation>>>;
+        using ErrType = geode::impl::ResultErrType<impl::OperationResult<Range, Operation>>;
+
+        auto size = static_cast<std::size_t>(std::ranges::size(range));
+        impl::FirstErr<ErrType> first(size);
+
+        // std::vector<bool> packs its elements, so threads can not write to it concurrently
+        if constexpr (std::is_default_constructible_v<OkType> && std::is_move_assignable_v<OkType> &&
+                      !std::is_same_v<OkType, bool>) {
+            std::vector<OkType> values(size);
+            impl::runOperation(range, operation, options, first, [&](std::size_t index, auto&& res) {
+                values[index] = std::move(res).unwrap();
+            });
+            if (first.failed()) {
+                return first.takeErr();
+            }
+            return Ok(std::move(values));
+        }
+        else {
+            std::vector<std::optional<OkType>> slots(size);
+            impl::runOperation(range, operation, options, first, [&](std::size_t index, auto&& res) {
+                slots[index].emplace(std::move(res).unwrap());
+            });
+            if (first.failed()) {
+                return first.takeErr();
+            }
+            std::vector<OkType> values;
+            values.reserve(size);
+            for (auto& slot : slots) {
+                values.push_back(std::move(*slot));
+            }
+            return Ok(std::move(values));
+        }
+    }
+}
+
+#endif
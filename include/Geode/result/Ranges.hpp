@@ -0,0 +1,303 @@
+#ifndef GEODE_RESULT_RANGES_HPP
+#define GEODE_RESULT_RANGES_HPP
+
+#include "../Result.hpp"
+
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace geode {
+    namespace impl {
+        /// @brief The Result type of the elements of a range
+        template <class Range>
+        using RangeResult = std::remove_cvref_t<std::ranges::range_reference_t<Range>>;
+
+        /// @brief A range whose elements are Results with a non-void Ok type
+        template <class Range>
+        concept ResultRange = std::ranges::input_range<Range> && IsResult<RangeResult<Range>> &&
+            !std::is_void_v<ResultOkType<RangeResult<Range>>>;
+
+        template <class Range>
+        struct IsOwningView : std::false_type {};
+
+        template <class Range>
+        struct IsOwningView<std::ranges::owning_view<Range>> : std::true_type {};
+
+        /// @brief Whether the elements of a range can be moved out of it: they are
+        /// yielded as rvalues, or the range is an rvalue that owns them, which
+        /// views other than owning_view do not
+        template <class Range>
+        constexpr bool MovesElements = !std::is_lvalue_reference_v<std::ranges::range_reference_t<Range>> ||
+            (!std::is_lvalue_reference_v<Range> &&
+             (!std::ranges::view<std::remove_cvref_t<Range>> || IsOwningView<std::remove_cvref_t<Range>>::value));
+
+        /// @brief Forwards an element of a range, moving it out only if the range
+        /// owns it, so that views over lvalue containers leave them untouched
+        template <class Range, class Element>
+        constexpr decltype(auto) forwardElement(Element& element) noexcept {
+            if constexpr (MovesElements<Range>) {
+                return std::move(element);
+            }
+            else {
+                return static_cast<Element const&>(element);
+            }
+        }
+
+        template <class Container, class Range>
+        constexpr void reserveFor(Container& container, Range& range) {
+            if constexpr (std::ranges::sized_range<Range> && requires { container.reserve(std::size_t()); }) {
+                container.reserve(static_cast<std::size_t>(std::ranges::size(range)));
+            }
+        }
+
+        template <class Container, class Value>
+        constexpr void appendTo(Container& container, Value&& value) {
+            if constexpr (requires { container.push_back(std::forward<Value>(value)); }) {
+                container.push_back(std::forward<Value>(value));
+            }
+            else {
+                container.insert(container.end(), std::forward<Value>(value));
+            }
+        }
+    }
+
+    /// @brief Collects the Ok values of a range of Results into a Container,
+    /// stopping at the first Err
+    /// @note Pass an owning range as an rvalue to move the values out of it
+    /// @param range the range of Results
+    /// @return the Container of Ok values, or the first Err
+    template <class Container, impl::ResultRange Range>
+    constexpr Result<Container, std::remove_cvref_t<impl::ResultErrType<impl::RangeResult<Range>>>> collect(Range&& range) {
+        Container container;
+        impl::reserveFor(container, range);
+        for (auto&& element : range) {
+            if (element.isErr()) {
+                return impl::forwardElement<Range>(element).asErr();
+            }
+            impl::appendTo(container, impl::forwardElement<Range>(element).unwrap());
+        }
+        return Ok(std::move(container));
+    }
+
+    /// @brief Collects the Ok values of a range of Results into a Container,
+    /// stopping at the first Err
+    /// @note Pass an owning range as an rvalue to move the values out of it
+    /// @param range the range of Results
+    /// @return the Container of Ok values, or the first Err
+    template <template <class...> class Container = std::vector, impl::ResultRange Range>
+    constexpr auto collect(Range&& range) {
+        using OkType = std::remove_cvref_t<impl::ResultOkType<impl::RangeResult<Range>>>;
+        return collect<Container<OkType>>(std::forward<Range>(range));
+    }
+
+    /// @brief Collects the Ok values of a range of Results into a Container,
+    /// or every Err if there are any
+    /// @note Pass an owning range as an rvalue to move the values out of it
+    /// @param range the range of Results
+    /// @return the Container of Ok values, or all of the Errs in order
+    template <class Container, class ErrContainer, impl::ResultRange Range>
+        requires(!std::is_void_v<impl::ResultErrType<impl::RangeResult<Range>>>)
+    constexpr Result<Container, ErrContainer> collectAll(Range&& range) {
+        Container container;
+        ErrContainer errors;
+        impl::reserveFor(container, range);
+        for (auto&& element : range) {
+            if (element.isErr()) {
+                impl::appendTo(errors, impl::forwardElement<Range>(element).unwrapErr());
+            }
+            else if (errors.empty()) {
+                impl::appendTo(container, impl::forwardElement<Range>(element).unwrap());
+            }
+        }
+        if (!errors.empty()) {
+            return GEODE_RESULT_IMPL_PROPAGATED(Err(std::move(errors)));
+        }
+        return Ok(std::move(container));
+    }
+
+    /// @brief Collects the Ok values of a range of Results into a Container,
+    /// or every Err if there are any
+    /// @note Pass an owning range as an rvalue to move the values out of it
+    /// @param range the range of Results
+    /// @return the Container of Ok values, or a std::vector of all of the Errs in order
+    template <template <class...> class Container = std::vector, impl::ResultRange Range>
+    constexpr auto collectAll(Range&& range) {
+        using OkType = std::remove_cvref_t<impl::ResultOkType<impl::RangeResult<Range>>>;
+        using ErrType = std::remove_cvref_t<impl::ResultErrType<impl::RangeResult<Range>>>;
+        return collectAll<Container<OkType>, std::vector<ErrType>>(std::forward<Range>(range));
+    }
+
+    namespace impl {
+        enum class ResultViewKind {
+            Oks,
+            Errs,
+            TakeWhileOk,
+        };
+
+        /// @brief View over the Ok or Err values of a range of Results
+        /// @note Ranges yielding Results by value are read once per element, the
+        /// current Result is kept in the iterator and the view is an input range
+        template <std::ranges::input_range View, ResultViewKind Kind>
+            requires std::ranges::view<View> && IsResult<RangeResult<View>>
+        class ResultView : public std::ranges::view_interface<ResultView<View, Kind>> {
+        protected:
+            using Element = RangeResult<View>;
+
+            static constexpr bool Caches = !std::is_lvalue_reference_v<std::ranges::range_reference_t<View>>;
+            static constexpr bool IsForward = !Caches && std::ranges::forward_range<View>;
+
+            struct NoCache {};
+
+            class Sentinel {};
+
+            class Iterator {
+            protected:
+                std::ranges::iterator_t<View> m_current{};
+                std::ranges::sentinel_t<View> m_end{};
+                [[no_unique_address]] mutable std::conditional_t<Caches, std::optional<Element>, NoCache> m_cache;
+                bool m_stopped = false;
+
+                constexpr decltype(auto) current() const {
+                    if constexpr (Caches) {
+                        return (*m_cache);
+                    }
+                    else {
+                        return *m_current;
+                    }
+                }
+
+                constexpr void satisfy() {
+                    for (; m_current != m_end; ++m_current) {
+                        if constexpr (Caches) {
+                            m_cache.emplace(*m_current);
+                        }
+                        if constexpr (Kind == ResultViewKind::Oks) {
+                            if (this->current().isOk()) return;
+                        }
+                        else if constexpr (Kind == ResultViewKind::Errs) {
+                            if (this->current().isErr()) return;
+                        }
+                        else {
+                            m_stopped = this->current().isErr();
+                            return;
+                        }
+                    }
+                }
+
+            public:
+                using iterator_concept =
+                    std::conditional_t<IsForward, std::forward_iterator_tag, std::input_iterator_tag>;
+                using difference_type = std::ranges::range_difference_t<View>;
+                using value_type = std::remove_cvref_t<std::conditional_t<
+                    Kind == ResultViewKind::Errs, ResultErrType<Element>, ResultOkType<Element>>>;
+
+                Iterator() = default;
+
+                constexpr Iterator(std::ranges::iterator_t<View> current, std::ranges::sentinel_t<View> end) :
+                    m_current(std::move(current)), m_end(std::move(end)) {
+                    this->satisfy();
+                }
+
+                constexpr decltype(auto) operator*() const {
+                    if constexpr (Kind == ResultViewKind::Errs) {
+                        return this->current().unwrapErr();
+                    }
+                    else {
+                        return this->current().unwrap();
+                    }
+                }
+
+                constexpr Iterator& operator++() {
+                    ++m_current;
+                    this->satisfy();
+                    return *this;
+                }
+
+                constexpr void operator++(int) requires(!IsForward) {
+                    ++*this;
+                }
+
+                constexpr Iterator operator++(int) requires IsForward {
+                    auto copy = *this;
+                    ++*this;
+                    return copy;
+                }
+
+                friend constexpr bool operator==(Iterator const& iterator, Sentinel) {
+                    return iterator.m_stopped || iterator.m_current == iterator.m_end;
+                }
+
+                friend constexpr bool operator==(Iterator const& first, Iterator const& second)
+                    requires IsForward
+                {
+                    return first.m_current == second.m_current && first.m_stopped == second.m_stopped;
+                }
+            };
+
+            View m_base;
+
+        public:
+            ResultView() requires std::default_initializable<View> = default;
+
+            constexpr explicit ResultView(View base) : m_base(std::move(base)) {}
+
+            constexpr View base() const& requires std::copy_constructible<View> {
+                return m_base;
+            }
+
+            constexpr View base() && {
+                return std::move(m_base);
+            }
+
+            constexpr Iterator begin() {
+                return Iterator(std::ranges::begin(m_base), std::ranges::end(m_base));
+            }
+
+            constexpr Sentinel end() const noexcept {
+                return Sentinel();
+            }
+        };
+
+        template <ResultViewKind Kind>
+        struct ResultViewAdaptor {
+            template <std::ranges::viewable_range Range>
+            constexpr auto operator()(Range&& range) const {
+                return ResultView<std::views::all_t<Range>, Kind>(std::views::all(std::forward<Range>(range)));
+            }
+
+            template <std::ranges::viewable_range Range>
+            friend constexpr auto operator|(Range&& range, ResultViewAdaptor const& adaptor) {
+                return adaptor(std::forward<Range>(range));
+            }
+        };
+
+        struct TransformOkAdaptor {
+            template <class Operation>
+            constexpr auto operator()(Operation&& operation) const {
+                return std::views::transform([operation = std::forward<Operation>(operation)](auto&& result) {
+                    return std::forward<decltype(result)>(result).map(operation);
+                });
+            }
+        };
+    }
+
+    namespace views {
+        /// @brief Lazily yields the Ok values of a range of Results, skipping Errs
+        inline constexpr impl::ResultViewAdaptor<impl::ResultViewKind::Oks> oks;
+
+        /// @brief Lazily yields the Err values of a range of Results, skipping Oks
+        inline constexpr impl::ResultViewAdaptor<impl::ResultViewKind::Errs> errs;
+
+        /// @brief Lazily yields the Ok values of a range of Results, up to the first Err
+        inline constexpr impl::ResultViewAdaptor<impl::ResultViewKind::TakeWhileOk> takeWhileOk;
+
+        /// @brief Lazily maps the Ok value of every Result in a range with an operation
+        inline constexpr impl::TransformOkAdaptor transformOk;
+    }
+}
+
+#endif
@@ -0,0 +1,201 @@
+#ifndef GEODE_RESULT_SLOT_HPP
+#define GEODE_RESULT_SLOT_HPP
+
+#include "../Result.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace geode {
+    namespace impl {
+        // A 32 bit state lets std::atomic::wait go straight to a futex on Linux
+        enum class ResultSlotState : std::uint32_t {
+            Empty,
+            Ok,
+            Err,
+        };
+
+        /// @brief Arguments a side of a Result can be constructed in place from,
+        /// references are bound to a single argument
+        template <class Type, class... Args>
+        concept SlotConstructible = (std::is_reference_v<Type>
+            ? (sizeof...(Args) == 1 && (std::is_convertible_v<Args&&, Type> && ...))
+            : std::is_constructible_v<typename ResultStorageTraits<Type>::Stored, Args&&...>);
+    }
+
+    /// @brief Hands a Result from one thread to another without a lock or an
+    /// allocation, one value at a time
+    /// @note There must be at most one thread setting values and one thread
+    /// getting them. A value can be set again once the previous one was taken,
+    /// so the slot can carry a stream of Results between two threads
+    template <class OkType = void, class ErrType = GEODE_RESULT_DEFAULT_ERROR>
+    class ResultSlot final {
+    public:
+        using ResultType = Result<OkType, ErrType>;
+
+    protected:
+        using State = impl::ResultSlotState;
+        using OkTraits = impl::ResultStorageTraits<OkType>;
+        using ErrTraits = impl::ResultStorageTraits<ErrType>;
+        using OkStored = typename OkTraits::Stored;
+        using ErrStored = typename ErrTraits::Stored;
+
+        union Storage {
+            OkStored ok;
+            ErrStored err;
+
+            Storage() noexcept {}
+            ~Storage() {}
+        };
+
+        std::atomic<State> m_state = State::Empty;
+        Storage m_storage;
+
+        template <class Type, class Stored, class... Args>
+        static void construct(Stored& stored, Args&&... args) {
+            if constexpr (std::is_reference_v<Type>) {
+                std::construct_at(&stored, impl::ResultStorageTraits<Type>::store(std::forward<Args>(args)...));
+            }
+            else {
+                std::construct_at(&stored, std::forward<Args>(args)...);
+            }
+        }
+
+        /// @brief Blocks the producer until the previous value was taken
+        void waitEmpty() const noexcept {
+            auto state = m_state.load(std::memory_order_acquire);
+            while (state != State::Empty) {
+                m_state.wait(state, std::memory_order_acquire);
+                state = m_state.load(std::memory_order_acquire);
+            }
+        }
+
+        void publish(State state) noexcept {
+            m_state.store(state, std::memory_order_release);
+            m_state.notify_one();
+        }
+
+        void destroy(State state) noexcept {
+            if (state == State::Ok) {
+                std::destroy_at(&m_storage.ok);
+            }
+            else if (state == State::Err) {
+                std::destroy_at(&m_storage.err);
+            }
+        }
+
+        /// @brief Moves the value out of the slot and empties it
+        /// @note If moving the value throws, it is left in the slot
+        ResultType take(State state) {
+            auto result = [&]() -> ResultType {
+                if (state == State::Ok) {
+                    if constexpr (std::is_void_v<OkType>) {
+                        return Ok();
+                    }
+                    else {
+                        return Ok(OkTraits::get(std::move(m_storage.ok)));
+                    }
+                }
+                if constexpr (std::is_void_v<ErrType>) {
+                    return GEODE_RESULT_IMPL_PROPAGATED(Err());
+                }
+                else {
+                    return GEODE_RESULT_IMPL_PROPAGATED(Err(ErrTraits::get(std::move(m_storage.err))));
+                }
+            }();
+            this->destroy(state);
+            this->publish(State::Empty);
+            return result;
+        }
+
+    public:
+        ResultSlot() noexcept = default;
+
+        ResultSlot(ResultSlot const&) = delete;
+        ResultSlot& operator=(ResultSlot const&) = delete;
+
+        ~ResultSlot() {
+            this->destroy(m_state.load(std::memory_order_acquire));
+        }
+
+        /// @brief Constructs an Ok value in place and wakes the consumer
+        /// @note Called from the producer thread, blocks until the previous
+        /// value was taken
+        template <class... Args>
+            requires impl::SlotConstructible<OkType, Args...>
+        void emplaceOk(Args&&... args) {
+            this->waitEmpty();
+            construct<OkType>(m_storage.ok, std::forward<Args>(args)...);
+            this->publish(State::Ok);
+        }
+
+        /// @brief Constructs an Err value in place and wakes the consumer
+        /// @note Called from the producer thread, blocks until the previous
+        /// value was taken
+        template <class... Args>
+            requires impl::SlotConstructible<ErrType, Args...>
+        void emplaceErr(Args&&... args) {
+            this->waitEmpty();
+            construct<ErrType>(m_storage.err, std::forward<Args>(args)...);
+            this->publish(State::Err);
+        }
+
+        /// @brief Moves the value of a Result into the slot and wakes the consumer
+        /// @note Called from the producer thread, blocks until the previous
+        /// value was taken
+        void set(ResultType&& result) {
+            if (result.isOk()) {
+                if constexpr (std::is_void_v<OkType>) {
+                    this->emplaceOk();
+                }
+                else {
+                    this->emplaceOk(std::move(result).unwrap());
+                }
+            }
+            else {
+                if constexpr (std::is_void_v<ErrType>) {
+                    this->emplaceErr();
+                }
+                else {
+                    this->emplaceErr(std::move(result).unwrapErr());
+                }
+            }
+        }
+
+        /// @brief Returns true if a value is waiting to be taken
+        bool ready() const noexcept {
+            return m_state.load(std::memory_order_acquire) != State::Empty;
+        }
+
+        /// @brief Blocks until a value is waiting to be taken
+        void wait() const noexcept {
+            m_state.wait(State::Empty, std::memory_order_acquire);
+        }
+
+        /// @brief Blocks until a value is set, then moves it out of the slot
+        /// @note Called from the consumer thread
+        ResultType get() {
+            auto state = m_state.load(std::memory_order_acquire);
+            while (state == State::Empty) {
+                m_state.wait(State::Empty, std::memory_order_acquire);
+                state = m_state.load(std::memory_order_acquire);
+            }
+            return this->take(state);
+        }
+
+        /// @brief Moves the value out of the slot if one was set, without blocking
+        /// @note Called from the consumer thread
+        std::optional<ResultType> tryGet() {
+            auto state = m_state.load(std::memory_order_acquire);
+            if (state == State::Empty) {
+                return std::nullopt;
+            }
+            return this->take(state);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef GEODE_RESULT_SYS_HPP
+#define GEODE_RESULT_SYS_HPP
+
+#include "../Result.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/mman.h>)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    #define GEODE_RESULT_IMPL_POSIX 1
+#endif
+
+namespace geode {
+    namespace impl {
+        // strerror_r is either the GNU version returning the message, or the
+        // POSIX one returning 0 on success, depending on the feature macros
+        inline std::string_view strerrorMessage(char const* message, char const*) noexcept {
+            return message;
+        }
+
+        inline std::string_view strerrorMessage(int result, char const* buffer) noexcept {
+            return result == 0 ? std::string_view(buffer) : std::string_view();
+        }
+    }
+
+    /// @brief An errno value, as a 4 byte error type that is only turned into a
+    /// message when it is displayed
+    /// @note INT_MIN, which errno never holds and the public constructors never
+    /// produce, is used as the niche of Result<void, Errno>, which is thus as
+    /// small as an int. Every other code, including 0, is an error
+    class Errno final {
+    protected:
+        static constexpr int NicheCode = INT_MIN;
+
+        int m_code = 0;
+
+        struct NicheTag {};
+
+        constexpr explicit Errno(NicheTag) noexcept : m_code(NicheCode) {}
+
+        friend struct ResultNiche<Errno>;
+
+    public:
+        /// @brief The size of a buffer that fits any message
+        static constexpr std::size_t MessageSize = 128;
+
+        constexpr Errno() noexcept = default;
+
+        /// @brief Constructs an Errno from a code, with INT_MIN, which is reserved
+        /// as the niche, turned into INT_MIN + 1
+        constexpr explicit Errno(int code) noexcept : m_code(code == NicheCode ? NicheCode + 1 : code) {}
+
+        /// @brief Returns the current value of errno
+        static Errno last() noexcept {
+            return Errno(errno);
+        }
+
+        /// @brief Returns the errno value
+        constexpr int code() const noexcept {
+            return m_code;
+        }
+
+        /// @brief Returns whether the operation would have blocked, and should be
+        /// retried once the file is ready
+        constexpr bool wouldBlock() const noexcept {
+            return m_code == EAGAIN || m_code == EWOULDBLOCK;
+        }
+
+        /// @brief Formats the message without allocating
+        /// @param buffer the buffer to format into
+        /// @param size the size of the buffer, MessageSize fits any message
+        /// @return a view to the message, which may point to the buffer or to a
+        /// static string
+        std::string_view message(char* buffer, std::size_t size) const noexcept {
+#if defined(_WIN32)
+            if (strerror_s(buffer, size, m_code) != 0) {
+                return std::string_view();
+            }
+            return std::string_view(buffer);
+#else
+            return impl::strerrorMessage(::strerror_r(m_code, buffer, size), buffer);
+#endif
+        }
+
+        /// @brief Returns the message
+        std::string message() const {
+            char buffer[MessageSize];
+            return std::string(this->message(buffer, sizeof(buffer)));
+        }
+
+        operator std::string() const {
+            return this->message();
+        }
+
+        friend constexpr bool operator==(Errno const& error, Errno const& other) noexcept = default;
+
+        friend constexpr bool operator==(Errno const& error, int code) noexcept {
+            return error.m_code == code;
+        }
+
+        template <class Stream>
+            requires requires(Stream& stream, std::string_view message) { stream << message; }
+        friend Stream& operator<<(Stream& stream, Errno const& error) {
+            char buffer[MessageSize];
+            stream << error.message(buffer, sizeof(buffer));
+            return stream;
+        }
+    };
+
+    template <>
+    struct ResultNiche<Errno> {
+        static constexpr Errno value() noexcept {
+            return Errno(Errno::NicheTag());
+        }
+    };
+
+#if defined(GEODE_RESULT_IMPL_POSIX)
+    /// @brief Wrappers of POSIX calls that return a Result instead of setting errno
+    /// @note Calls interrupted by a signal are retried, except for close, which
+    /// must not be retried on Linux
+    namespace sys {
+        namespace impl {
+            template <class Call>
+            auto retryInterrupted(Call&& call) noexcept {
+                auto result = call();
+                while (result == -1 && errno == EINTR) {
+                    result = call();
+                }
+                return result;
+            }
+
+            template <class Value>
+            Result<Value, Errno> check(Value value) noexcept {
+                if (value == Value(-1)) [[unlikely]] {
+                    return Err(Errno::last());
+                }
+                return Ok(value);
+            }
+
+            inline Result<void, Errno> checkVoid(int value) noexcept {
+                if (value == -1) [[unlikely]] {
+                    return Err(Errno::last());
+                }
+                return Ok();
+            }
+        }
+
+        /// @brief Opens a file
+        /// @return the file descriptor
+        inline Result<int, Errno> open(char const* path, int flags, mode_t mode = 0) noexcept {
+            return impl::check(impl::retryInterrupted([&] {
+                return ::open(path, flags, mode);
+            }));
+        }
+
+        /// @brief Closes a file descriptor
+        inline Result<void, Errno> close(int fd) noexcept {
+            return impl::checkVoid(::close(fd));
+        }
+
+        /// @brief Reads from the current position of a file
+        /// @return the number of bytes read, 0 at the end of the file
+        inline Result<std::size_t, Errno> read(int fd, void* buffer, std::size_t size) noexcept {
+            return impl::check(impl::retryInterrupted([&] {
+                return ::read(fd, buffer, size);
+            })).map([](ssize_t count) {
+                return static_cast<std::size_t>(count);
+            });
+        }
+
+        /// @brief Reads from an offset of a file, without moving its position
+        /// @return the number of bytes read, 0 at the end of the file
+        inline Result<std::size_t, Errno> pread(int fd, void* buffer, std::size_t size, off_t offset) noexcept {
+            return impl::check(impl::retryInterrupted([&] {
+                return ::pread(fd, buffer, size, offset);
+            })).map([](ssize_t count) {
+                return static_cast<std::size_t>(count);
+            });
+        }
+
+        /// @brief Writes at the current position of a file
+        /// @return the number of bytes written
+        inline Result<std::size_t, Errno> write(int fd, void const* buffer, std::size_t size) noexcept {
+            return impl::check(impl::retryInterrupted([&] {
+                return ::write(fd, buffer, size);
+            })).map([](ssize_t count) {
+                return static_cast<std::size_t>(count);
+            });
+        }
+
+        /// @brief Writes at an offset of a file, without moving its position
+        /// @return the number of bytes written
+        inline Result<std::size_t, Errno> pwrite(int fd, void const* buffer, std::size_t size, off_t offset) noexcept {
+            return impl::check(impl::retryInterrupted([&] {
+                return ::pwrite(fd, buffer, size, offset);
+            })).map([](ssize_t count) {
+                return static_cast<std::size_t>(count);
+            });
+        }
+
+        /// @brief Moves the position of a file
+        /// @return the new position
+        inline Result<off_t, Errno> lseek(int fd, off_t offset, int whence) noexcept {
+            return impl::check(::lseek(fd, offset, whence));
+        }
+
+        /// @brief Returns the status of an open file
+        inline Result<struct stat, Errno> fstat(int fd) noexcept {
+            struct stat status;
+            if (::fstat(fd, &status) == -1) [[unlikely]] {
+                return Err(Errno::last());
+            }
+            return Ok(status);
+        }
+
+        /// @brief Returns the status of a file
+        inline Result<struct stat, Errno> stat(char const* path) noexcept {
+            struct stat status;
+            if (::stat(path, &status) == -1) [[unlikely]] {
+                return Err(Errno::last());
+            }
+            return Ok(status);
+        }
+
+        /// @brief Sets the size of a file
+        inline Result<void, Errno> ftruncate(int fd, off_t size) noexcept {
+            return impl::checkVoid(impl::retryInterrupted([&] {
+                return ::ftruncate(fd, size);
+            }));
+        }
+
+        /// @brief Flushes the data and metadata of a file to its device
+        inline Result<void, Errno> fsync(int fd) noexcept {
+            return impl::checkVoid(impl::retryInterrupted([&] {
+                return ::fsync(fd);
+            }));
+        }
+
+        /// @brief Maps a file or anonymous memory
+        /// @return the address of the mapping
+        inline Result<void*, Errno> mmap(void* address, std::size_t size, int protection, int flags, int fd, off_t offset) noexcept {
+            void* mapping = ::mmap(address, size, protection, flags, fd, offset);
+            if (mapping == MAP_FAILED) [[unlikely]] {
+                return Err(Errno::last());
+            }
+            return Ok(mapping);
+        }
+
+        /// @brief Removes a mapping
+        inline Result<void, Errno> munmap(void* address, std::size_t size) noexcept {
+            return impl::checkVoid(::munmap(address, size));
+        }
+
+        /// @brief Tells the kernel how a mapping will be used
+        inline Result<void, Errno> madvise(void* address, std::size_t size, int advice) noexcept {
+            return impl::checkVoid(::madvise(address, size, advice));
+        }
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,632 @@
+#ifndef GEODE_RESULT_TASKS_HPP
+#define GEODE_RESULT_TASKS_HPP
+
+#include "../Result.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stop_token>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace geode {
+    /// @brief A unit of work handed to an Executor
+    /// @note Tasks are owned by whoever submits them and are never copied or
+    /// allocated by the executor, which can link them through `next` while
+    /// they are queued
+    class ExecutorTask {
+    protected:
+        void (*m_run)(ExecutorTask*);
+
+    public:
+        /// @brief Free for the executor to use while the task is queued
+        ExecutorTask* next = nullptr;
+
+        explicit ExecutorTask(void (*run)(ExecutorTask*)) noexcept : m_run(run) {}
+
+        /// @brief Runs the task, after which it must not be touched again
+        void run() noexcept {
+            m_run(this);
+        }
+    };
+
+    /// @brief Anything that can run ExecutorTasks, now or later on any thread
+    /// @note An executor may also have `bool tryRunOne()`, which runs a queued task
+    /// on the calling thread if there is one. Threads waiting for tasks then help
+    /// run them instead of blocking
+    template <class Type>
+    concept Executor = requires(Type& executor, ExecutorTask& task) {
+        executor.execute(task);
+    };
+
+    /// @brief Runs every task immediately on the thread submitting it
+    class InlineExecutor {
+    public:
+        void execute(ExecutorTask& task) noexcept {
+            task.run();
+        }
+    };
+
+    /// @brief A fixed set of threads, each with its own queue of tasks, that take
+    /// tasks from each other's queues once their own is empty
+    class ThreadPool {
+    protected:
+        struct Queue {
+            std::mutex mutex;
+            ExecutorTask* head = nullptr;
+            ExecutorTask* tail = nullptr;
+        };
+
+        struct Worker {
+            ThreadPool* pool = nullptr;
+            std::size_t index = 0;
+        };
+
+        std::size_t m_size;
+        std::unique_ptr<Queue[]> m_queues;
+        std::atomic<std::size_t> m_next = 0;
+        std::atomic<std::size_t> m_queued = 0;
+        std::mutex m_sleepMutex;
+        std::condition_variable_any m_wake;
+        // declared last so that the threads are joined before anything they use is destroyed
+        std::vector<std::jthread> m_threads;
+
+        static Worker& currentWorker() noexcept {
+            static thread_local Worker worker;
+            return worker;
+        }
+
+        static ExecutorTask* pop(Queue& queue) {
+            std::lock_guard lock(queue.mutex);
+            auto task = queue.head;
+            if (task) {
+                queue.head = task->next;
+                if (!queue.head) {
+                    queue.tail = nullptr;
+                }
+            }
+            return task;
+        }
+
+        /// @brief Runs a task from the queue at start, or from any other queue
+        bool runOne(std::size_t start) {
+            for (std::size_t i = 0; i < m_size; ++i) {
+                if (auto task = pop(m_queues[(start + i) % m_size])) {
+                    m_queued.fetch_sub(1, std::memory_order_relaxed);
+                    task->run();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void work(std::stop_token stop, std::size_t index) {
+            currentWorker() = Worker{this, index};
+            while (!stop.stop_requested()) {
+                if (this->runOne(index)) {
+                    continue;
+                }
+                std::unique_lock lock(m_sleepMutex);
+                m_wake.wait(lock, stop, [&] {
+                    return m_queued.load(std::memory_order_relaxed) > 0;
+                });
+            }
+        }
+
+    public:
+        /// @brief Starts a number of threads, 0 uses std::thread::hardware_concurrency()
+        explicit ThreadPool(std::size_t threads = 0) :
+            m_size(threads ? threads : std::max(1u, std::thread::hardware_concurrency())),
+            m_queues(std::make_unique<Queue[]>(m_size)) {
+            m_threads.reserve(m_size);
+            for (std::size_t i = 0; i < m_size; ++i) {
+                m_threads.emplace_back([this, i](std::stop_token stop) {
+                    this->work(std::move(stop), i);
+                });
+            }
+        }
+
+        ThreadPool(ThreadPool const&) = delete;
+        ThreadPool& operator=(ThreadPool const&) = delete;
+
+        /// @brief Returns a pool shared by the whole program, used when no executor is given
+        static ThreadPool& shared() {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /// @brief Returns the number of threads
+        std::size_t size() const noexcept {
+            return m_size;
+        }
+
+        /// @brief Queues a task, on the queue of the calling thread if it is one of
+        /// the pool's threads
+        void execute(ExecutorTask& task) {
+            auto& worker = currentWorker();
+            auto index = worker.pool == this ? worker.index : m_next.fetch_add(1, std::memory_order_relaxed) % m_size;
+            auto& queue = m_queues[index];
+            // counted before it is queued, so that a worker taking it can not
+            // bring the count below zero
+            m_queued.fetch_add(1, std::memory_order_relaxed);
+            {
+                std::lock_guard lock(queue.mutex);
+                task.next = nullptr;
+                if (queue.tail) {
+                    queue.tail->next = &task;
+                }
+                else {
+                    queue.head = &task;
+                }
+                queue.tail = &task;
+            }
+            // taking the lock orders the increment with a worker checking it before sleeping
+            { std::lock_guard lock(m_sleepMutex); }
+            m_wake.notify_one();
+        }
+
+        /// @brief Runs one queued task on the calling thread
+        /// @return false if there was no task to run
+        bool tryRunOne() {
+            auto& worker = currentWorker();
+            return this->runOne(worker.pool == this ? worker.index : 0);
+        }
+    };
+
+    namespace impl {
+        template <class Task>
+        concept TakesToken = std::invocable<Task&, std::stop_token>;
+
+        /// @brief Calls a task, passing it a stop token if it takes one
+        template <class Task>
+        decltype(auto) invokeTask(Task& task, std::stop_token const& token) {
+            if constexpr (TakesToken<Task>) {
+                return std::invoke(task, token);
+            }
+            else {
+                return std::invoke(task);
+            }
+        }
+
+        template <class Task>
+        using TaskResult =
+            std::remove_cvref_t<decltype(invokeTask(std::declval<Task&>(), std::declval<std::stop_token const&>()))>;
+
+        /// @brief A callable returning a Result, optionally taking a std::stop_token
+        template <class Task>
+        concept ResultTask = (std::invocable<Task&> || TakesToken<Task>) &&
+            IsResult<TaskResult<Task>>;
+
+        template <class Range>
+        using RangeTask = std::remove_reference_t<std::ranges::range_reference_t<Range>>;
+
+        /// @brief Whether the tasks of a range are temporaries, which the nodes
+        /// running them have to own, such as those of a transform view
+        template <class Range>
+        constexpr bool OwnsRangeTasks = !std::is_lvalue_reference_v<std::ranges::range_reference_t<Range>>;
+
+        template <class Range>
+        concept ResultTaskRange = std::ranges::forward_range<Range> && std::ranges::sized_range<Range> &&
+            ResultTask<RangeTask<Range>> && (!OwnsRangeTasks<Range> || std::move_constructible<RangeTask<Range>>);
+
+        /// @brief The type void Ok values are given in a tuple
+        template <class Type>
+        using TupleValue = std::conditional_t<std::is_void_v<Type>, std::monostate, Type>;
+
+        /// @brief Shared state of a group of tasks being waited for together
+        class TaskGroup {
+        protected:
+            static constexpr std::size_t Undecided = static_cast<std::size_t>(-1);
+
+            std::atomic<std::size_t> m_remaining;
+            std::atomic<std::size_t> m_decided = Undecided;
+            std::atomic_flag m_thrown;
+            std::exception_ptr m_exception;
+            std::atomic<bool> m_stopped = false;
+            // only allocated when a task takes a std::stop_token
+            std::stop_source m_stop;
+            std::mutex m_mutex;
+            std::condition_variable m_finished;
+            bool m_done;
+
+            void requestStop() noexcept {
+                m_stopped.store(true, std::memory_order_relaxed);
+                m_stop.request_stop();
+            }
+
+        public:
+            TaskGroup(std::size_t count, bool tokens) :
+                m_remaining(count), m_stop(tokens ? std::stop_source() : std::stop_source(std::nostopstate)),
+                m_done(count == 0) {}
+
+            TaskGroup(TaskGroup const&) = delete;
+            TaskGroup& operator=(TaskGroup const&) = delete;
+
+            std::stop_token token() const noexcept {
+                return m_stop.get_token();
+            }
+
+            bool stopRequested() const noexcept {
+                return m_stopped.load(std::memory_order_relaxed);
+            }
+
+            /// @brief Records the task whose Result decides the outcome, if no other
+            /// task did already, and asks the others to stop
+            void decide(std::size_t index) noexcept {
+                auto expected = Undecided;
+                if (m_decided.compare_exchange_strong(expected, index, std::memory_order_relaxed)) {
+                    this->requestStop();
+                }
+            }
+
+            void fail(std::exception_ptr exception) noexcept {
+                if (!m_thrown.test_and_set(std::memory_order_relaxed)) {
+                    m_exception = std::move(exception);
+                }
+                this->requestStop();
+            }
+
+            /// @brief Marks a number of tasks as finished, the group may be destroyed
+            /// as soon as the last task calls this
+            void finish(std::size_t count = 1) {
+                if (m_remaining.fetch_sub(count, std::memory_order_acq_rel) == count) {
+                    // notifying under the lock keeps the waiter from destroying the
+                    // group before this thread is done with it
+                    std::lock_guard lock(m_mutex);
+                    m_done = true;
+                    m_finished.notify_all();
+                }
+            }
+
+            /// @brief Blocks until every task has finished, running queued tasks on
+            /// this thread meanwhile if the executor allows it
+            template <class Exec>
+            void wait(Exec& executor) {
+                if constexpr (requires { executor.tryRunOne(); }) {
+                    while (m_remaining.load(std::memory_order_acquire) != 0 && executor.tryRunOne()) {}
+                }
+                std::unique_lock lock(m_mutex);
+                m_finished.wait(lock, [&] { return m_done; });
+            }
+
+            /// @brief Gives up on the tasks that were not submitted after submitting
+            /// one threw, and waits for the submitted ones, which point into the
+            /// frame the exception is about to unwind
+            template <class Exec>
+            void abandon(Exec& executor, std::size_t unsubmitted) {
+                this->requestStop();
+                if (unsubmitted) {
+                    this->finish(unsubmitted);
+                }
+                this->wait(executor);
+            }
+
+            /// @brief Returns the index of the deciding task, if there was one
+            std::optional<std::size_t> decided() const noexcept {
+                auto index = m_decided.load(std::memory_order_relaxed);
+                return index == Undecided ? std::nullopt : std::optional(index);
+            }
+
+            /// @brief Rethrows the first exception thrown by a task, if there was one
+            void rethrow() {
+                if (m_exception) {
+                    std::rethrow_exception(m_exception);
+                }
+            }
+        };
+
+        enum class WhenKind {
+            // the first Err decides the outcome
+            All,
+            // the first Ok decides the outcome
+            Any,
+        };
+
+        /// @brief A task of a group along with the Result it returned
+        /// @note The task is referenced, unless Owning is set for tasks that are
+        /// temporaries, in which case it is moved into the node
+        template <class Task, WhenKind Kind, bool Owning = false>
+        class TaskNode : public ExecutorTask {
+        public:
+            using ResultType = TaskResult<Task>;
+
+        protected:
+            TaskGroup* m_group;
+            std::conditional_t<Owning, Task, Task*> m_task;
+            std::size_t m_index;
+
+            Task& task() noexcept {
+                if constexpr (Owning) {
+                    return m_task;
+                }
+                else {
+                    return *m_task;
+                }
+            }
+
+            static void runNode(ExecutorTask* task) noexcept {
+                auto& node = static_cast<TaskNode&>(*task);
+                auto& group = *node.m_group;
+                // tasks that have not started once the outcome is known are skipped
+                if (!group.stopRequested()) {
+#if __cpp_exceptions
+                    try {
+#endif
+                        node.result.emplace(invokeTask(node.task(), group.token()));
+                        if (Kind == WhenKind::All ? node.result->isErr() : node.result->isOk()) {
+                            group.decide(node.m_index);
+                        }
+#if __cpp_exceptions
+                    }
+                    catch (...) {
+                        group.fail(std::current_exception());
+                    }
+#endif
+                }
+                group.finish();
+            }
+
+        public:
+            std::optional<ResultType> result;
+
+            TaskNode(TaskGroup& group, Task& task, std::size_t index) noexcept requires(!Owning) :
+                ExecutorTask(&TaskNode::runNode), m_group(&group), m_task(&task), m_index(index) {}
+
+            TaskNode(TaskGroup& group, Task&& task, std::size_t index)
+                noexcept(std::is_nothrow_move_constructible_v<Task>) requires(Owning) :
+                ExecutorTask(&TaskNode::runNode), m_group(&group), m_task(std::move(task)), m_index(index) {}
+        };
+
+        template <class Exec, class... Nodes>
+        void runNodes(Exec& executor, TaskGroup& group, Nodes&... nodes) {
+            std::size_t submitted = 0;
+#if __cpp_exceptions
+            try {
+#endif
+                ((executor.execute(nodes), ++submitted), ...);
+#if __cpp_exceptions
+            }
+            catch (...) {
+                group.abandon(executor, sizeof...(Nodes) - submitted);
+                throw;
+            }
+#endif
+            group.wait(executor);
+            group.rethrow();
+        }
+
+        template <class Exec, class Range, WhenKind Kind>
+        auto runRange(Exec& executor, Range& tasks, TaskGroup& group) {
+            using Node = TaskNode<RangeTask<Range>, Kind, OwnsRangeTasks<Range>>;
+            std::vector<Node> nodes;
+            // reserved up front, since the nodes must not move once submitted
+            nodes.reserve(static_cast<std::size_t>(std::ranges::size(tasks)));
+            std::size_t index = 0;
+            for (auto&& task : tasks) {
+                nodes.emplace_back(group, std::forward<decltype(task)>(task), index++);
+            }
+            std::size_t submitted = 0;
+#if __cpp_exceptions
+            try {
+#endif
+                for (auto& node : nodes) {
+                    executor.execute(node);
+                    ++submitted;
+                }
+#if __cpp_exceptions
+            }
+            catch (...) {
+                group.abandon(executor, nodes.size() - submitted);
+                throw;
+            }
+#endif
+            group.wait(executor);
+            group.rethrow();
+            return nodes;
+        }
+
+        template <class Exec, std::size_t... Indices, class... Tasks>
+        auto whenAllTuple(Exec& executor, std::index_sequence<Indices...>, Tasks&... tasks) {
+            using ErrType = ResultErrType<TaskResult<std::tuple_element_t<0, std::tuple<Tasks...>>>>;
+            using OutType = Result<std::tuple<TupleValue<ResultOkType<TaskResult<Tasks>>>...>, ErrType>;
+
+            TaskGroup group(sizeof...(Tasks), (TakesToken<Tasks> || ...));
+            std::tuple<TaskNode<Tasks, WhenKind::All>...> nodes(
+                TaskNode<Tasks, WhenKind::All>(group, tasks, Indices)...
+            );
+            runNodes(executor, group, std::get<Indices>(nodes)...);
+
+            if (auto decided = group.decided()) {
+                std::optional<OutType> out;
+                ((Indices == *decided && (out.emplace(std::move(*std::get<Indices>(nodes).result).asErr()), true)) || ...);
+                return std::move(*out);
+            }
+
+            auto value = [](auto& node) -> decltype(auto) {
+                using Ok = ResultOkType<typename std::remove_reference_t<decltype(node)>::ResultType>;
+                if constexpr (std::is_void_v<Ok>) {
+                    return std::monostate();
+                }
+                else {
+                    return std::move(*node.result).unwrap();
+                }
+            };
+            return OutType(Ok(std::tuple<TupleValue<ResultOkType<TaskResult<Tasks>>>...>(
+                value(std::get<Indices>(nodes))...
+            )));
+        }
+
+        template <class Exec, std::size_t... Indices, class... Tasks>
+        auto whenAnyTuple(Exec& executor, std::index_sequence<Indices...>, Tasks&... tasks) {
+            using ResultType = TaskResult<std::tuple_element_t<0, std::tuple<Tasks...>>>;
+            using OutType = Result<ResultOkType<ResultType>, std::vector<ResultErrType<ResultType>>>;
+
+            TaskGroup group(sizeof...(Tasks), (TakesToken<Tasks> || ...));
+            std::tuple<TaskNode<Tasks, WhenKind::Any>...> nodes(
+                TaskNode<Tasks, WhenKind::Any>(group, tasks, Indices)...
+            );
+            runNodes(executor, group, std::get<Indices>(nodes)...);
+
+            if (auto decided = group.decided()) {
+                std::optional<OutType> out;
+                ((Indices == *decided && (out.emplace(std::move(*std::get<Indices>(nodes).result)
+                    .mapErr([](auto&&) { return std::vector<ResultErrType<ResultType>>(); })), true)) || ...);
+                return std::move(*out);
+            }
+
+            std::vector<ResultErrType<ResultType>> errs;
+            errs.reserve(sizeof...(Tasks));
+            (errs.push_back(std::move(*std::get<Indices>(nodes).result).unwrapErr()), ...);
+            return OutType(GEODE_RESULT_IMPL_PROPAGATED(Err(std::move(errs))));
+        }
+
+        template <class... Tasks>
+        concept SameErrType = (std::same_as<
+            ResultErrType<TaskResult<Tasks>>,
+            ResultErrType<TaskResult<std::tuple_element_t<0, std::tuple<Tasks...>>>>> && ...);
+
+        template <class... Tasks>
+        concept SameResultType = (std::same_as<
+            TaskResult<Tasks>,
+            TaskResult<std::tuple_element_t<0, std::tuple<Tasks...>>>> && ...);
+    }
+
+    /// @brief Runs tasks returning Results concurrently on an executor and waits
+    /// for all of them
+    /// @note Once a task returns Err, tasks that have not started yet are skipped
+    /// and the std::stop_token given to the running ones is signalled. The call
+    /// still returns only once no task is running
+    /// @param executor the executor to run the tasks on
+    /// @param tasks callables returning Results with the same Err type, optionally
+    /// taking a std::stop_token
+    /// @return a tuple of every Ok value, with std::monostate for void, or the
+    /// first Err returned
+    template <Executor Exec, impl::ResultTask... Tasks>
+        requires(sizeof...(Tasks) > 0 && impl::SameErrType<std::remove_reference_t<Tasks>...>)
+    auto whenAll(Exec& executor, Tasks&&... tasks) {
+        return impl::whenAllTuple(executor, std::index_sequence_for<Tasks...>(), tasks...);
+    }
+
+    /// @brief Runs tasks returning Results concurrently on the shared ThreadPool
+    /// and waits for all of them
+    /// @return a tuple of every Ok value, with std::monostate for void, or the
+    /// first Err returned
+    template <impl::ResultTask... Tasks>
+        requires(sizeof...(Tasks) > 0 && impl::SameErrType<std::remove_reference_t<Tasks>...>)
+    auto whenAll(Tasks&&... tasks) {
+        return whenAll(ThreadPool::shared(), std::forward<Tasks>(tasks)...);
+    }
+
+    /// @brief Runs a range of tasks returning Results concurrently on an executor
+    /// and waits for all of them
+    /// @note Once a task returns Err, tasks that have not started yet are skipped
+    /// and the std::stop_token given to the running ones is signalled
+    /// @return every Ok value in the order of the tasks, or the first Err returned
+    template <Executor Exec, impl::ResultTaskRange Range>
+    auto whenAll(Exec& executor, Range&& tasks) {
+        using ResultType = impl::TaskResult<impl::RangeTask<Range>>;
+        using OkType = impl::ResultOkType<ResultType>;
+        using ErrType = impl::ResultErrType<ResultType>;
+        using OutType = std::conditional_t<
+            std::is_void_v<OkType>, Result<void, ErrType>, Result<std::vector<impl::TupleValue<OkType>>, ErrType>>;
+
+        impl::TaskGroup group(static_cast<std::size_t>(std::ranges::size(tasks)), impl::TakesToken<impl::RangeTask<Range>>);
+        auto nodes = impl::runRange<Exec, std::remove_reference_t<Range>, impl::WhenKind::All>(executor, tasks, group);
+
+        if (auto decided = group.decided()) {
+            return OutType(std::move(*nodes[*decided].result).asErr());
+        }
+        if constexpr (std::is_void_v<OkType>) {
+            return OutType(Ok());
+        }
+        else {
+            std::vector<OkType> values;
+            values.reserve(nodes.size());
+            for (auto& node : nodes) {
+                values.push_back(std::move(*node.result).unwrap());
+            }
+            return OutType(Ok(std::move(values)));
+        }
+    }
+
+    /// @brief Runs a range of tasks returning Results concurrently on the shared
+    /// ThreadPool and waits for all of them
+    /// @return every Ok value in the order of the tasks, or the first Err returned
+    template <impl::ResultTaskRange Range>
+    auto whenAll(Range&& tasks) {
+        return whenAll(ThreadPool::shared(), std::forward<Range>(tasks));
+    }
+
+    /// @brief Runs tasks returning the same type of Result concurrently on an
+    /// executor until one of them returns Ok
+    /// @note Once a task returns Ok, tasks that have not started yet are skipped
+    /// and the std::stop_token given to the running ones is signalled. The call
+    /// still returns only once no task is running
+    /// @return the first Ok value returned, or every Err in the order of the tasks
+    template <Executor Exec, impl::ResultTask... Tasks>
+        requires(sizeof...(Tasks) > 0 && impl::SameResultType<std::remove_reference_t<Tasks>...> &&
+                 (!std::is_void_v<impl::ResultErrType<impl::TaskResult<std::remove_reference_t<Tasks>>>> && ...))
+    auto whenAny(Exec& executor, Tasks&&... tasks) {
+        return impl::whenAnyTuple(executor, std::index_sequence_for<Tasks...>(), tasks...);
+    }
+
+    /// @brief Runs tasks returning the same type of Result concurrently on the
+    /// shared ThreadPool until one of them returns Ok
+    /// @return the first Ok value returned, or every Err in the order of the tasks
+    template <impl::ResultTask... Tasks>
+        requires(sizeof...(Tasks) > 0 && impl::SameResultType<std::remove_reference_t<Tasks>...> &&
+                 (!std::is_void_v<impl::ResultErrType<impl::TaskResult<std::remove_reference_t<Tasks>>>> && ...))
+    auto whenAny(Tasks&&... tasks) {
+        return whenAny(ThreadPool::shared(), std::forward<Tasks>(tasks)...);
+    }
+
+    /// @brief Runs a range of tasks returning Results concurrently on an executor
+    /// until one of them returns Ok
+    /// @note Once a task returns Ok, tasks that have not started yet are skipped
+    /// and the std::stop_token given to the running ones is signalled
+    /// @return the first Ok value returned, or every Err in the order of the tasks
+    template <Executor Exec, impl::ResultTaskRange Range>
+        requires(!std::is_void_v<impl::ResultErrType<impl::TaskResult<impl::RangeTask<Range>>>>)
+    auto whenAny(Exec& executor, Range&& tasks) {
+        using ResultType = impl::TaskResult<impl::RangeTask<Range>>;
+        using ErrType = impl::ResultErrType<ResultType>;
+        using OutType = Result<impl::ResultOkType<ResultType>, std::vector<ErrType>>;
+
+        impl::TaskGroup group(static_cast<std::size_t>(std::ranges::size(tasks)), impl::TakesToken<impl::RangeTask<Range>>);
+        auto nodes = impl::runRange<Exec, std::remove_reference_t<Range>, impl::WhenKind::Any>(executor, tasks, group);
+
+        if (auto decided = group.decided()) {
+            return OutType(std::move(*nodes[*decided].result).mapErr([](auto&&) { return std::vector<ErrType>(); }));
+        }
+        std::vector<ErrType> errs;
+        errs.reserve(nodes.size());
+        for (auto& node : nodes) {
+            errs.push_back(std::move(*node.result).unwrapErr());
+        }
+        return OutType(GEODE_RESULT_IMPL_PROPAGATED(Err(std::move(errs))));
+    }
+
+    /// @brief Runs a range of tasks returning Results concurrently on the shared
+    /// ThreadPool until one of them returns Ok
+    /// @return the first Ok value returned, or every Err in the order of the tasks
+    template <impl::ResultTaskRange Range>
+        requires(!std::is_void_v<impl::ResultErrType<impl::TaskResult<impl::RangeTask<Range>>>>)
+    auto whenAny(Range&& tasks) {
+        return whenAny(ThreadPool::shared(), std::forward<Range>(tasks));
+    }
+}
+
+#endif
@@ -0,0 +1,314 @@
+#ifndef GEODE_RESULT_TRACE_HPP
+#define GEODE_RESULT_TRACE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <source_location>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if !defined(GEODE_RESULT_TRACE_SAMPLE_RATE)
+    // One in how many Errs of a thread is traced by default
+    #define GEODE_RESULT_TRACE_SAMPLE_RATE 64
+#endif
+
+#if !defined(GEODE_RESULT_TRACE_COLD)
+    #if defined(__GNUC__) || defined(__clang__)
+        #define GEODE_RESULT_TRACE_COLD [[gnu::cold, gnu::noinline]]
+    #elif defined(_MSC_VER)
+        #define GEODE_RESULT_TRACE_COLD __declspec(noinline)
+    #else
+        #define GEODE_RESULT_TRACE_COLD
+    #endif
+#endif
+
+#if !defined(GEODE_RESULT_TRACE_CAPACITY)
+    // The number of events each thread can hold until drained, must be a power of two
+    #define GEODE_RESULT_TRACE_CAPACITY 1024
+#endif
+
+namespace geode::tracing {
+    /// @brief A traced Err: when and where it was created, and what it was
+    struct ErrEvent {
+        /// @brief Nanoseconds since the system clock epoch
+        std::uint64_t timestamp;
+        char const* file;
+        char const* function;
+        std::uint32_t line;
+        std::uint32_t column;
+        /// @brief The name of the error type, as spelled by the compiler
+        std::string_view type;
+        /// @brief A small number identifying the thread that created the Err
+        std::uint32_t thread;
+        std::uint8_t messageSize;
+        char messageData[47];
+
+        /// @brief Returns the start of the error message, if the error type has one
+        std::string_view message() const noexcept {
+            return std::string_view(messageData, messageSize);
+        }
+    };
+
+    namespace impl {
+        static_assert(
+            (GEODE_RESULT_TRACE_CAPACITY & (GEODE_RESULT_TRACE_CAPACITY - 1)) == 0,
+            "GEODE_RESULT_TRACE_CAPACITY must be a power of two"
+        );
+
+        template <class Type>
+        constexpr std::string_view typeName() noexcept {
+            std::string_view name = std::source_location::current().function_name();
+#if defined(_MSC_VER) && !defined(__clang__)
+            auto start = name.find("typeName<") + 9;
+            return name.substr(start, name.rfind(">(") - start);
+#else
+            auto start = name.find("Type = ") + 7;
+            auto end = name.find(';', start);
+            return name.substr(start, (end == name.npos ? name.rfind(']') : end) - start);
+#endif
+        }
+
+        template <class Type>
+        inline constexpr std::string_view typeNameOf = typeName<Type>();
+
+        // Writes a short description of an error without allocating: its text if it
+        // has one, its value if it is a number or an enum, and nothing otherwise
+        template <class ErrType>
+        std::size_t describe(ErrType const& error, char* out, std::size_t size) noexcept {
+            if constexpr (std::is_convertible_v<ErrType const&, std::string_view>) {
+                return std::string_view(error).copy(out, size);
+            }
+            else if constexpr (requires {
+                                   { error.message() } noexcept -> std::same_as<std::string_view>;
+                               }) {
+                return error.message().copy(out, size);
+            }
+            else if constexpr (requires { error.root().message(); }) {
+                return impl::describe(error.root(), out, size);
+            }
+            else if constexpr (std::is_enum_v<ErrType>) {
+                return impl::describe(static_cast<std::underlying_type_t<ErrType>>(error), out, size);
+            }
+            else if constexpr (std::is_arithmetic_v<ErrType> && !std::same_as<ErrType, bool>) {
+                return std::to_chars(out, out + size, error).ptr - out;
+            }
+            else {
+                return 0;
+            }
+        }
+
+        // A single producer, single consumer queue of the events of one thread
+        struct Ring {
+            // written by the thread that owns the ring
+            alignas(64) std::atomic<std::uint64_t> head = 0;
+            // written by whoever drains the ring
+            alignas(64) std::atomic<std::uint64_t> tail = 0;
+            // cleared when the owning thread exits, so that another thread can adopt the ring
+            std::atomic<bool> owned = true;
+            Ring* next = nullptr;
+            ErrEvent events[GEODE_RESULT_TRACE_CAPACITY];
+        };
+
+        // Never destroyed, so that threads still running during static destruction
+        // and Errs traced from later static destructors never see a freed ring
+        struct Registry {
+            // every ring ever created, rings are only added and never unlinked or freed
+            std::atomic<Ring*> rings = nullptr;
+            std::mutex drainMutex;
+            std::atomic<std::uint32_t> sampleRate = GEODE_RESULT_TRACE_SAMPLE_RATE;
+            std::atomic<std::uint32_t> nextThread = 0;
+            std::atomic<std::uint64_t> dropped = 0;
+        };
+
+        inline constinit Registry registry{};
+
+        // Errs left until the next one is traced on this thread
+        inline constinit thread_local std::uint32_t countdown = 0;
+
+        // set once the RingOwner of this thread is destroyed, after which its
+        // Errs are dropped instead of being written to a ring it gave away
+        inline constinit thread_local bool ringReleased = false;
+
+        struct RingOwner {
+            Ring* ring = nullptr;
+            std::uint32_t thread = 0;
+
+            ~RingOwner() {
+                ringReleased = true;
+                if (ring) {
+                    ring->owned.store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        inline Ring* acquireRing() noexcept {
+            for (Ring* ring = registry.rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+                bool owned = false;
+                if (ring->owned.compare_exchange_strong(owned, true, std::memory_order_acquire)) {
+                    return ring;
+                }
+            }
+            Ring* ring = new (std::nothrow) Ring();
+            if (!ring) {
+                return nullptr;
+            }
+            ring->next = registry.rings.load(std::memory_order_relaxed);
+            while (!registry.rings.compare_exchange_weak(ring->next, ring, std::memory_order_release)) {}
+            return ring;
+        }
+
+        inline RingOwner& ringOwner() noexcept {
+            thread_local RingOwner owner;
+            if (!owner.ring) {
+                owner.ring = impl::acquireRing();
+                owner.thread = registry.nextThread.fetch_add(1, std::memory_order_relaxed);
+            }
+            return owner;
+        }
+
+        // Small errors are passed to the cold path by value, so that the Result
+        // being constructed does not have to be spilled to the stack for it
+        template <class ErrType>
+        using TraceArg = std::conditional_t<
+            std::is_trivially_copyable_v<ErrType> && sizeof(ErrType) <= 2 * sizeof(void*), ErrType, ErrType const&>;
+
+        template <class ErrType>
+        GEODE_RESULT_TRACE_COLD void trace(std::source_location location, TraceArg<ErrType> error) noexcept {
+            if (ringReleased) [[unlikely]] {
+                registry.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            auto& owner = impl::ringOwner();
+            Ring* ring = owner.ring;
+            if (!ring) {
+                registry.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            std::uint64_t head = ring->head.load(std::memory_order_relaxed);
+            if (head - ring->tail.load(std::memory_order_acquire) == GEODE_RESULT_TRACE_CAPACITY) {
+                registry.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            auto& event = ring->events[head & (GEODE_RESULT_TRACE_CAPACITY - 1)];
+            auto now = std::chrono::system_clock::now().time_since_epoch();
+            event.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+            event.file = location.file_name();
+            event.function = location.function_name();
+            event.line = location.line();
+            event.column = location.column();
+            event.type = typeNameOf<ErrType>;
+            event.thread = owner.thread;
+            event.messageSize = static_cast<std::uint8_t>(impl::describe(error, event.messageData, sizeof(event.messageData)));
+            ring->head.store(head + 1, std::memory_order_release);
+        }
+
+        template <class Stream>
+        void writeJsonString(Stream& stream, std::string_view str) {
+            stream << '"';
+            for (char c : str) {
+                if (c == '"' || c == '\\') {
+                    stream << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20) {
+                    constexpr char hex[] = "0123456789abcdef";
+                    stream << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+                }
+                else {
+                    stream << c;
+                }
+            }
+            stream << '"';
+        }
+    }
+
+    /// @brief Traces an Err created at a call site, if it is sampled
+    /// @note Only decrements a thread local counter for Errs that are not
+    /// sampled. A sampled Err is written to the ring of the current thread
+    /// without locking, and dropped if the ring is full. This is what
+    /// GEODE_RESULT_ON_ERR calls when GEODE_RESULT_TRACING is defined
+    template <class ErrType>
+    void recordErr(std::source_location const& location, ErrType const& error) noexcept {
+        if (impl::countdown > 1) [[likely]] {
+            --impl::countdown;
+            return;
+        }
+        impl::countdown = impl::registry.sampleRate.load(std::memory_order_relaxed);
+        if (impl::countdown != 0) {
+            impl::trace<ErrType>(location, error);
+        }
+    }
+
+    /// @brief Traces one in every rate Errs of each thread, or none if rate is 0
+    /// @note The calling thread follows the new rate from its next Err on, other
+    /// threads pick it up after their next traced Err
+    inline void setSampleRate(std::uint32_t rate) noexcept {
+        impl::registry.sampleRate.store(rate, std::memory_order_relaxed);
+        impl::countdown = 0;
+    }
+
+    /// @brief Returns the rate set with setSampleRate
+    inline std::uint32_t sampleRate() noexcept {
+        return impl::registry.sampleRate.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Returns the number of sampled Errs lost because a ring was full
+    inline std::uint64_t dropped() noexcept {
+        return impl::registry.dropped.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Calls an operation with every traced event not drained yet, in
+    /// order for each thread
+    /// @note Safe to call from any thread while Errs are being traced, and
+    /// concurrent drains are serialized. Errs created by the operation itself
+    /// are traced as usual
+    /// @return the number of events drained
+    template <class Operation>
+        requires std::invocable<Operation&, ErrEvent const&>
+    std::size_t drain(Operation&& operation) {
+        std::lock_guard lock(impl::registry.drainMutex);
+        std::size_t count = 0;
+        for (auto* ring = impl::registry.rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+            std::uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+            std::uint64_t const head = ring->head.load(std::memory_order_acquire);
+            for (; tail != head; ++tail, ++count) {
+                operation(ring->events[tail & (GEODE_RESULT_TRACE_CAPACITY - 1)]);
+                ring->tail.store(tail + 1, std::memory_order_release);
+            }
+        }
+        return count;
+    }
+
+    /// @brief Writes an event as a single line of JSON
+    template <class Stream>
+    Stream& writeJson(Stream& stream, ErrEvent const& event) {
+        stream << "{\"timestamp\":" << event.timestamp << ",\"thread\":" << event.thread << ",\"file\":";
+        impl::writeJsonString(stream, event.file);
+        stream << ",\"line\":" << event.line << ",\"column\":" << event.column << ",\"function\":";
+        impl::writeJsonString(stream, event.function);
+        stream << ",\"type\":";
+        impl::writeJsonString(stream, event.type);
+        stream << ",\"message\":";
+        impl::writeJsonString(stream, event.message());
+        stream << "}\n";
+        return stream;
+    }
+
+    /// @brief Drains every traced event into a stream as JSON lines
+    /// @return the number of events written
+    template <class Stream>
+    std::size_t exportJsonLines(Stream& stream) {
+        return tracing::drain([&](ErrEvent const& event) {
+            tracing::writeJson(stream, event);
+        });
+    }
+}
+
+#endif
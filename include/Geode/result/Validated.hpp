@@ -0,0 +1,551 @@
+#ifndef GEODE_RESULT_VALIDATED_HPP
+#define GEODE_RESULT_VALIDATED_HPP
+
+#include "../Result.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace geode {
+    /// @brief A vector that stores up to N elements inline, and only allocates
+    /// once it grows past them
+    template <class Type, std::size_t N>
+        requires(!std::is_reference_v<Type> && !std::is_void_v<Type>)
+    class SmallVector final {
+    protected:
+        Type* m_data;
+        std::size_t m_size = 0;
+        std::size_t m_capacity = N;
+        alignas(Type) std::byte m_inline[N == 0 ? 1 : N * sizeof(Type)];
+
+        Type* inlineData() noexcept {
+            return reinterpret_cast<Type*>(m_inline);
+        }
+
+        /// @brief Moves the elements to a heap buffer of at least capacity
+        /// elements, constructing a new last element in it first when Emplace is
+        /// set, so that args may refer to an element being moved
+        template <bool Emplace, class... Args>
+        void grow(std::size_t capacity, Args&&... args) {
+            capacity = std::max({capacity, m_capacity * 2, std::size_t(1)});
+            std::allocator<Type> allocator;
+            Type* data = allocator.allocate(capacity);
+#if __cpp_exceptions
+            try {
+#endif
+                if constexpr (Emplace) {
+                    std::construct_at(data + m_size, std::forward<Args>(args)...);
+                }
+#if __cpp_exceptions
+                try {
+#endif
+                    std::uninitialized_move(m_data, m_data + m_size, data);
+#if __cpp_exceptions
+                }
+                catch (...) {
+                    if constexpr (Emplace) {
+                        std::destroy_at(data + m_size);
+                    }
+                    throw;
+                }
+            }
+            catch (...) {
+                allocator.deallocate(data, capacity);
+                throw;
+            }
+#endif
+            std::destroy(m_data, m_data + m_size);
+            this->release();
+            m_data = data;
+            m_capacity = capacity;
+        }
+
+        /// @brief Frees the heap buffer, if there is one
+        void release() noexcept {
+            if (!this->isInline()) {
+                std::allocator<Type>().deallocate(m_data, m_capacity);
+            }
+        }
+
+        /// @brief Takes the elements of other, leaving it empty
+        void take(SmallVector&& other) {
+            if (other.isInline()) {
+                std::uninitialized_move(other.m_data, other.m_data + other.m_size, m_data);
+                m_size = other.m_size;
+                other.clear();
+            }
+            else {
+                m_data = std::exchange(other.m_data, other.inlineData());
+                m_size = std::exchange(other.m_size, 0);
+                m_capacity = std::exchange(other.m_capacity, N);
+            }
+        }
+
+    public:
+        /// @brief The number of elements stored without allocating
+        static constexpr std::size_t InlineCapacity = N;
+
+        SmallVector() noexcept : m_data(this->inlineData()) {}
+
+        SmallVector(std::initializer_list<Type> values) : SmallVector() {
+            this->append(std::span<Type const>(values.begin(), values.size()));
+        }
+
+        SmallVector(SmallVector const& other) : SmallVector() {
+            this->append(std::span<Type const>(other));
+        }
+
+        SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>) : SmallVector() {
+            this->take(std::move(other));
+        }
+
+        SmallVector& operator=(SmallVector const& other) {
+            if (this != &other) {
+                this->clear();
+                this->append(std::span<Type const>(other));
+            }
+            return *this;
+        }
+
+        SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+            if (this != &other) {
+                this->clear();
+                if (!other.isInline()) {
+                    this->release();
+                    m_data = this->inlineData();
+                    m_capacity = N;
+                }
+                this->take(std::move(other));
+            }
+            return *this;
+        }
+
+        ~SmallVector() {
+            this->clear();
+            this->release();
+        }
+
+        /// @brief Returns the number of elements
+        std::size_t size() const noexcept {
+            return m_size;
+        }
+
+        /// @brief Returns the number of elements that fit without allocating
+        std::size_t capacity() const noexcept {
+            return m_capacity;
+        }
+
+        /// @brief Returns true if there are no elements
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        /// @brief Returns true if the elements are stored inline, without a heap allocation
+        bool isInline() const noexcept {
+            return m_data == reinterpret_cast<Type const*>(m_inline);
+        }
+
+        Type* data() noexcept {
+            return m_data;
+        }
+
+        Type const* data() const noexcept {
+            return m_data;
+        }
+
+        Type* begin() noexcept {
+            return m_data;
+        }
+
+        Type const* begin() const noexcept {
+            return m_data;
+        }
+
+        Type* end() noexcept {
+            return m_data + m_size;
+        }
+
+        Type const* end() const noexcept {
+            return m_data + m_size;
+        }
+
+        Type& operator[](std::size_t index) noexcept {
+            return m_data[index];
+        }
+
+        Type const& operator[](std::size_t index) const noexcept {
+            return m_data[index];
+        }
+
+        Type& front() noexcept {
+            return m_data[0];
+        }
+
+        Type const& front() const noexcept {
+            return m_data[0];
+        }
+
+        Type& back() noexcept {
+            return m_data[m_size - 1];
+        }
+
+        Type const& back() const noexcept {
+            return m_data[m_size - 1];
+        }
+
+        operator std::span<Type>() noexcept {
+            return std::span<Type>(m_data, m_size);
+        }
+
+        operator std::span<Type const>() const noexcept {
+            return std::span<Type const>(m_data, m_size);
+        }
+
+        /// @brief Makes room for a number of elements
+        void reserve(std::size_t capacity) {
+            if (capacity > m_capacity) {
+                this->template grow<false>(capacity);
+            }
+        }
+
+        /// @brief Appends an element constructed in place
+        /// @return a reference to the new element
+        template <class... Args>
+        Type& emplaceBack(Args&&... args) {
+            if (m_size == m_capacity) [[unlikely]] {
+                this->template grow<true>(m_size + 1, std::forward<Args>(args)...);
+            }
+            else {
+                std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+            }
+            return m_data[m_size++];
+        }
+
+        void pushBack(Type const& value) {
+            this->emplaceBack(value);
+        }
+
+        void pushBack(Type&& value) {
+            this->emplaceBack(std::move(value));
+        }
+
+        /// @brief Removes the last element
+        void popBack() noexcept {
+            std::destroy_at(m_data + --m_size);
+        }
+
+        /// @brief Appends copies of a range of elements
+        void append(std::span<Type const> values) {
+            this->reserve(m_size + values.size());
+            for (auto const& value : values) {
+                std::construct_at(m_data + m_size, value);
+                ++m_size;
+            }
+        }
+
+        /// @brief Appends the elements of another vector, moving them
+        template <std::size_t N2>
+        void append(SmallVector<Type, N2>&& values) {
+            this->reserve(m_size + values.size());
+            for (auto& value : values) {
+                std::construct_at(m_data + m_size, std::move(value));
+                ++m_size;
+            }
+            values.clear();
+        }
+
+        /// @brief Removes every element, keeping the capacity
+        void clear() noexcept {
+            std::destroy(m_data, m_data + m_size);
+            m_size = 0;
+        }
+
+        friend bool operator==(SmallVector const& vector, SmallVector const& other) {
+            return std::equal(vector.begin(), vector.end(), other.begin(), other.end());
+        }
+    };
+
+    template <class OkType, class ErrType = GEODE_RESULT_DEFAULT_ERROR, std::size_t N = 4>
+        requires(!std::is_reference_v<OkType> && !std::is_reference_v<ErrType> && !std::is_void_v<ErrType>)
+    class Validated;
+
+    namespace impl {
+        template <class Type>
+        struct IsValidated : std::false_type {};
+
+        template <class OkType, class ErrType, std::size_t N>
+        struct IsValidated<Validated<OkType, ErrType, N>> : std::true_type {};
+
+        /// @brief Returns the Ok value of a Validated as a tuple, which is empty
+        /// for Validated<void>, so that combine can skip it
+        template <class Valid>
+        auto validatedValue(Valid&& valid) {
+            using OkType = typename std::remove_cvref_t<Valid>::OkType;
+            if constexpr (std::is_void_v<OkType>) {
+                return std::tuple<>();
+            }
+            else if constexpr (std::is_lvalue_reference_v<Valid>) {
+                return std::tuple<OkType const&>(valid.unwrap());
+            }
+            else {
+                return std::tuple<OkType&&>(std::move(valid).unwrap());
+            }
+        }
+
+        template <class Fn, class OkType>
+        struct ValidatedMapResult {
+            using type = std::invoke_result_t<Fn, OkType&&>;
+        };
+
+        template <class Fn>
+        struct ValidatedMapResult<Fn, void> {
+            using type = std::invoke_result_t<Fn>;
+        };
+    }
+
+    /// @brief Either a value or every error found while producing it
+    /// @note Unlike Result, Validateds combine applicatively: combine() checks
+    /// all of its inputs and gathers the errors of each of them, instead of
+    /// stopping at the first one. Up to N errors are stored without allocating
+    /// @tparam OkType the type of the value, void for checks without a value
+    /// @tparam ErrType the type of a single error
+    /// @tparam N the number of errors stored inline
+    template <class OkType_, class ErrType_, std::size_t N>
+        requires(!std::is_reference_v<OkType_> && !std::is_reference_v<ErrType_> && !std::is_void_v<ErrType_>)
+    class Validated final {
+    public:
+        using OkType = OkType_;
+        using ErrType = ErrType_;
+        using Errors = SmallVector<ErrType, N>;
+
+    protected:
+        using Stored = std::conditional_t<std::is_void_v<OkType>, std::monostate, OkType>;
+
+        // the errors are never empty
+        std::variant<Stored, Errors> m_data;
+
+    public:
+        /// @brief Constructs a valid Validated from an Ok
+        template <class OkType2>
+            requires(!std::is_void_v<OkType> && std::constructible_from<OkType, OkType2 &&>)
+        Validated(impl::OkContainer<OkType2>&& ok) :
+            m_data(std::in_place_index<0>, std::move(ok).unwrap()) {}
+
+        /// @brief Constructs a valid Validated<void>
+        Validated(impl::OkContainer<void>&&)
+            requires std::is_void_v<OkType>
+            : m_data(std::in_place_index<0>) {}
+
+        /// @brief Constructs an invalid Validated with a single error
+        template <class ErrType2>
+            requires std::constructible_from<ErrType, ErrType2 &&>
+        Validated(impl::ErrContainer<ErrType2>&& err) : m_data(std::in_place_index<1>) {
+            std::get<1>(m_data).emplaceBack(std::move(err).unwrap());
+        }
+
+        /// @brief Constructs an invalid Validated from its errors, which must not be empty
+        explicit Validated(Errors&& errors) : m_data(std::in_place_index<1>, std::move(errors)) {}
+
+        /// @brief Constructs a Validated from a Result, with its error if it is Err
+        template <class Res>
+            requires std::same_as<std::remove_cvref_t<Res>, Result<OkType, ErrType>>
+        Validated(Res&& result) : m_data(std::in_place_index<1>) {
+            if (result.isOk()) {
+                if constexpr (std::is_void_v<OkType>) {
+                    m_data.template emplace<0>();
+                }
+                else {
+                    m_data.template emplace<0>(std::forward<Res>(result).unwrap());
+                }
+            }
+            else {
+                std::get<1>(m_data).emplaceBack(std::forward<Res>(result).unwrapErr());
+            }
+        }
+
+        /// @brief Returns true if there is a value
+        bool isOk() const noexcept {
+            return m_data.index() == 0;
+        }
+
+        /// @brief Returns true if there are errors
+        bool isErr() const noexcept {
+            return m_data.index() == 1;
+        }
+
+        explicit operator bool() const noexcept {
+            return this->isOk();
+        }
+
+        /// @brief Unwraps the value
+        /// @throw UnwrapException with the first error if there are errors
+        decltype(auto) unwrap() && {
+            if (this->isErr()) [[unlikely]] {
+                impl::unwrapFailed(impl::ErrTag{}, std::get<1>(m_data).front());
+            }
+            if constexpr (!std::is_void_v<OkType>) {
+                return std::move(std::get<0>(m_data));
+            }
+        }
+
+        /// @brief Unwraps the value
+        /// @throw UnwrapException with the first error if there are errors
+        decltype(auto) unwrap() const& {
+            if (this->isErr()) [[unlikely]] {
+                impl::unwrapFailed(impl::ErrTag{}, std::get<1>(m_data).front());
+            }
+            if constexpr (!std::is_void_v<OkType>) {
+                return std::get<0>(m_data);
+            }
+        }
+
+        /// @brief Returns the errors, which are empty if there is a value
+        std::span<ErrType const> errors() const noexcept {
+            if (auto errors = std::get_if<1>(&m_data)) {
+                return *errors;
+            }
+            return {};
+        }
+
+        /// @brief Takes the errors, which are empty if there is a value
+        Errors unwrapErrors() && {
+            if (auto errors = std::get_if<1>(&m_data)) {
+                return std::move(*errors);
+            }
+            return Errors();
+        }
+
+        /// @brief Adds errors to the Validated, discarding the value
+        template <std::size_t N2>
+        void addErrors(SmallVector<ErrType, N2>&& errors) {
+            if (errors.empty()) {
+                return;
+            }
+            if (this->isOk()) {
+                m_data.template emplace<1>();
+            }
+            std::get<1>(m_data).append(std::move(errors));
+        }
+
+        /// @brief Maps the value, leaving the errors untouched
+        /// @param operation the function to call with the value
+        /// @return a Validated with the return value of the function
+        template <class Fn>
+        auto map(Fn&& operation) && {
+            using NewOk = typename impl::ValidatedMapResult<Fn, OkType>::type;
+            using Mapped = Validated<NewOk, ErrType, N>;
+            if (this->isErr()) {
+                return Mapped(std::move(std::get<1>(m_data)));
+            }
+            if constexpr (std::is_void_v<OkType> && std::is_void_v<NewOk>) {
+                std::invoke(std::forward<Fn>(operation));
+                return Mapped(Ok());
+            }
+            else if constexpr (std::is_void_v<OkType>) {
+                return Mapped(Ok(std::invoke(std::forward<Fn>(operation))));
+            }
+            else if constexpr (std::is_void_v<NewOk>) {
+                std::invoke(std::forward<Fn>(operation), std::move(std::get<0>(m_data)));
+                return Mapped(Ok());
+            }
+            else {
+                return Mapped(Ok(std::invoke(std::forward<Fn>(operation), std::move(std::get<0>(m_data)))));
+            }
+        }
+
+        /// @brief Converts to a Result, with every error if there are any
+        Result<OkType, Errors> toResult() && {
+            if (this->isErr()) {
+                return Err(std::move(std::get<1>(m_data)));
+            }
+            if constexpr (std::is_void_v<OkType>) {
+                return Ok();
+            }
+            else {
+                return Ok(std::move(std::get<0>(m_data)));
+            }
+        }
+
+        /// @brief Converts to a Result, with copies of every error if there are any
+        Result<OkType, Errors> toResult() const& {
+            return Validated(*this).toResult();
+        }
+
+        operator Result<OkType, Errors>() && {
+            return std::move(*this).toResult();
+        }
+    };
+
+    /// @brief Returns a Validated<void> with an error if a condition does not hold
+    /// @param condition the condition to check
+    /// @param err what the error is constructed from if the condition does not
+    /// hold, so that passing checks never build it
+    template <class ErrType = GEODE_RESULT_DEFAULT_ERROR, std::size_t N = 4, class Arg>
+        requires std::constructible_from<ErrType, Arg&&>
+    Validated<void, ErrType, N> check(bool condition, Arg&& err) {
+        if (condition) {
+            return Ok();
+        }
+        return Err(ErrType(std::forward<Arg>(err)));
+    }
+
+    /// @brief Combines Validateds: calls a function with their values if every
+    /// one of them is Ok, or gathers all of their errors otherwise
+    /// @param operation the function to call, with the values of every non-void Validated in order
+    /// @param valids the Validateds to combine, which all have the same error type and N
+    /// @return a Validated with the return value of the function, or every error
+    /// in the order of the Validateds
+    template <class Fn, class First, class... Rest>
+        requires(impl::IsValidated<std::remove_cvref_t<First>>::value &&
+                 (impl::IsValidated<std::remove_cvref_t<Rest>>::value && ...))
+    auto combine(Fn&& operation, First&& first, Rest&&... rest) {
+        using ErrType = typename std::remove_cvref_t<First>::ErrType;
+        using Errors = typename std::remove_cvref_t<First>::Errors;
+        static_assert(
+            (std::is_same_v<Errors, typename std::remove_cvref_t<Rest>::Errors> && ...),
+            "combine requires every Validated to have the same error type and N"
+        );
+        using NewOk = decltype(std::apply(
+            std::forward<Fn>(operation),
+            std::tuple_cat(impl::validatedValue(std::forward<First>(first)), impl::validatedValue(std::forward<Rest>(rest))...)
+        ));
+        using Combined = Validated<NewOk, ErrType, Errors::InlineCapacity>;
+
+        if (first.isOk() && (rest.isOk() && ...)) [[likely]] {
+            auto values = std::tuple_cat(
+                impl::validatedValue(std::forward<First>(first)), impl::validatedValue(std::forward<Rest>(rest))...
+            );
+            if constexpr (std::is_void_v<NewOk>) {
+                std::apply(std::forward<Fn>(operation), std::move(values));
+                return Combined(Ok());
+            }
+            else {
+                return Combined(Ok(std::apply(std::forward<Fn>(operation), std::move(values))));
+            }
+        }
+
+        Errors errors;
+        auto gather = [&]<class Valid>(Valid&& valid) {
+            if constexpr (std::is_lvalue_reference_v<Valid>) {
+                errors.append(valid.errors());
+            }
+            else {
+                errors.append(std::move(valid).unwrapErrors());
+            }
+        };
+        gather(std::forward<First>(first));
+        (gather(std::forward<Rest>(rest)), ...);
+        return Combined(std::move(errors));
+    }
+}
+
+#endif
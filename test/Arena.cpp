@@ -0,0 +1,129 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Arena.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <thread>
+
+using namespace geode;
+
+// counts the bytes that pass through it on their way to the global allocator
+class ArenaCountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocated = 0;
+    std::size_t deallocated = 0;
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        allocated += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+        deallocated += bytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+Result<int, Error> arenaParse(std::string const& str) {
+    if (str.empty() || str[0] < '0' || str[0] > '9') {
+        return Err("Could not parse '" + str + "'");
+    }
+    return Ok(str[0] - '0');
+}
+
+TEST_CASE("Arena") {
+    SECTION("Scope") {
+        ArenaCountingResource resource;
+        REQUIRE(ErrorArena::current() == nullptr);
+        {
+            ErrorArena::Scope scope(&resource);
+            REQUIRE(ErrorArena::current() == &resource);
+            auto res = arenaParse("some input that is too long for small strings");
+            REQUIRE(res.unwrapErr() == "Could not parse 'some input that is too long for small strings'");
+            REQUIRE(resource.allocated > 0);
+        }
+        REQUIRE(resource.deallocated == resource.allocated);
+        REQUIRE(ErrorArena::current() == nullptr);
+    }
+
+    SECTION("Literals") {
+        ArenaCountingResource resource;
+        ErrorArena::Scope scope(&resource);
+        Error error = "literal";
+        REQUIRE(error == "literal");
+        REQUIRE(resource.allocated == 0);
+    }
+
+    SECTION("Nested Scopes") {
+        ErrorArena outer;
+        ErrorArena inner;
+        ErrorArena::Scope outerScope(outer);
+        {
+            ErrorArena::Scope innerScope(inner);
+            REQUIRE(ErrorArena::current() == inner.resource());
+        }
+        REQUIRE(ErrorArena::current() == outer.resource());
+    }
+
+    SECTION("Release") {
+        ErrorArena arena;
+        ErrorArena::Scope scope(arena);
+        bool failed = true;
+        for (int i = 0; i < 1000; ++i) {
+            failed = failed && arenaParse("input number " + std::to_string(i) + " which does not parse").isErr();
+        }
+        REQUIRE(failed);
+        arena.release();
+        REQUIRE(arenaParse("x").unwrapErr() == "Could not parse 'x'");
+    }
+
+    SECTION("Explicit Resource") {
+        ArenaCountingResource resource;
+        {
+            Error error("copied into the resource", &resource);
+            auto copy = error;
+            REQUIRE(copy == "copied into the resource");
+            REQUIRE(copy.message().data() == error.message().data());
+            REQUIRE(resource.allocated > 0);
+        }
+        REQUIRE(resource.deallocated == resource.allocated);
+    }
+
+    SECTION("Context Frames") {
+        ArenaCountingResource resource;
+        {
+            ErrorArena::Scope scope(&resource);
+            Result<int, ContextError> res = Err("root");
+            for (int i = 0; i < 20; ++i) {
+                res = std::move(res).context("layer");
+            }
+            REQUIRE(res.unwrapErr().depth() == 20);
+            auto copy = res.unwrapErr();
+            REQUIRE(copy.message() == res.unwrapErr().message());
+            REQUIRE(resource.allocated >= 4 * sizeof(Error) * ContextError::ChunkFrames);
+        }
+        REQUIRE(resource.deallocated == resource.allocated);
+    }
+
+    SECTION("Per Thread") {
+        ErrorArena arena;
+        ErrorArena::Scope scope(arena);
+        std::pmr::memory_resource* other = arena.resource();
+        std::jthread([&] {
+            other = ErrorArena::current();
+        }).join();
+        REQUIRE(other == nullptr);
+    }
+
+    SECTION("pmr Strings") {
+        ErrorArena arena;
+        Result<int, std::pmr::string> res = Err(std::pmr::string("an error long enough to allocate its own buffer", arena.resource()));
+        REQUIRE(res.unwrapErr().get_allocator().resource() == arena.resource());
+    }
+}
@@ -0,0 +1,121 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Buffer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+using namespace geode;
+
+enum class BufferErrCode {
+    Overflow,
+    NotANumber,
+};
+
+// every seventh element is an Err
+ResultBuffer<float, BufferErrCode> makeBuffer(std::size_t size) {
+    ResultBuffer<float, BufferErrCode> buffer;
+    buffer.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        if (i % 7 == 3) {
+            buffer.pushErr(i % 2 ? BufferErrCode::Overflow : BufferErrCode::NotANumber);
+        }
+        else {
+            buffer.pushOk(static_cast<float>(i));
+        }
+    }
+    return buffer;
+}
+
+TEST_CASE("ResultBuffer") {
+    SECTION("Empty") {
+        ResultBuffer<float, BufferErrCode> buffer;
+        REQUIRE(buffer.empty());
+        REQUIRE(buffer.allOk());
+        REQUIRE(buffer.countErr() == 0);
+        REQUIRE(buffer.countErr(0, 10) == 0);
+        REQUIRE(!buffer.firstErr());
+    }
+
+    SECTION("Access") {
+        auto buffer = makeBuffer(200);
+        REQUIRE(buffer.size() == 200);
+        for (std::size_t i = 0; i < buffer.size(); ++i) {
+            auto res = buffer.at(i);
+            if (i % 7 == 3) {
+                REQUIRE(buffer.isErr(i));
+                REQUIRE(res.isErr());
+                REQUIRE(res.unwrapErr() == (i % 2 ? BufferErrCode::Overflow : BufferErrCode::NotANumber));
+            }
+            else {
+                REQUIRE(buffer.isOk(i));
+                REQUIRE(res.unwrap() == static_cast<float>(i));
+            }
+        }
+    }
+
+    SECTION("References") {
+        auto buffer = makeBuffer(10);
+        buffer[4].unwrap() = 40.f;
+        buffer[3].unwrapErr() = BufferErrCode::Overflow;
+        auto const& constBuffer = buffer;
+        REQUIRE(constBuffer[4].unwrap() == 40.f);
+        REQUIRE(constBuffer[3].unwrapErr() == BufferErrCode::Overflow);
+        REQUIRE(&constBuffer.at(4).unwrap() == &buffer.compactOks()[3]);
+    }
+
+    SECTION("Counts") {
+        auto buffer = makeBuffer(1000);
+        std::size_t errs = 0;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            errs += i % 7 == 3;
+        }
+        REQUIRE(buffer.countErr() == errs);
+        REQUIRE(buffer.countOk() == 1000 - errs);
+        REQUIRE(!buffer.allOk());
+
+        REQUIRE(buffer.countErr(0, 3) == 0);
+        REQUIRE(buffer.countErr(0, 4) == 1);
+        REQUIRE(buffer.countErr(3, 4) == 1);
+        REQUIRE(buffer.countErr(60, 130) == 10);
+        REQUIRE(buffer.countOk(60, 130) == 60);
+        REQUIRE(buffer.countErr(0, 5000) == errs);
+        REQUIRE(buffer.countErr(5, 5) == 0);
+    }
+
+    SECTION("firstErr") {
+        REQUIRE(makeBuffer(3).firstErr() == std::nullopt);
+        REQUIRE(makeBuffer(4).firstErr() == 3);
+
+        ResultBuffer<int, std::string> buffer;
+        for (int i = 0; i < 130; ++i) {
+            buffer.pushOk(i);
+        }
+        REQUIRE(buffer.allOk());
+        REQUIRE(!buffer.firstErr());
+        buffer.pushErr("Error");
+        REQUIRE(buffer.firstErr() == 130);
+        REQUIRE(buffer.at(130).unwrapErr() == "Error");
+    }
+
+    SECTION("compactOks") {
+        auto buffer = makeBuffer(15);
+        auto oks = buffer.compactOks();
+        REQUIRE(oks.size() == 13);
+        REQUIRE(oks[2] == 2.f);
+        REQUIRE(oks[3] == 4.f);
+        REQUIRE(buffer.compactErrs().size() == 2);
+
+        auto moved = std::move(buffer).compactOks();
+        REQUIRE(moved.size() == 13);
+    }
+
+    SECTION("push") {
+        ResultBuffer<std::string, std::string> buffer;
+        buffer.push(Result<std::string, std::string>(Ok("a")));
+        Result<std::string, std::string> err = Err("b");
+        buffer.push(err);
+        REQUIRE(buffer.at(0).unwrap() == "a");
+        REQUIRE(buffer.at(1).unwrapErr() == "b");
+        REQUIRE(err.unwrapErr() == "b");
+    }
+}
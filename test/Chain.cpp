@@ -0,0 +1,157 @@
+#include <Geode/Result.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+using namespace geode;
+
+struct Counters {
+    static inline int copies = 0;
+    static inline int allocations = 0;
+
+    static void reset() {
+        copies = 0;
+        allocations = 0;
+    }
+};
+
+template <class Type>
+struct CountingAllocator {
+    using value_type = Type;
+
+    CountingAllocator() = default;
+
+    template <class Other>
+    CountingAllocator(CountingAllocator<Other> const&) {}
+
+    Type* allocate(std::size_t count) {
+        ++Counters::allocations;
+        return std::allocator<Type>().allocate(count);
+    }
+
+    void deallocate(Type* ptr, std::size_t count) {
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    template <class Other>
+    bool operator==(CountingAllocator<Other> const&) const {
+        return true;
+    }
+};
+
+using CountedString = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+
+class CountedError {
+public:
+    CountedString message;
+
+    CountedError(char const* message) : message(message) {}
+
+    CountedError(CountedError const& other) : message(other.message) {
+        ++Counters::copies;
+    }
+
+    CountedError(CountedError&& other) = default;
+    CountedError& operator=(CountedError const& other) = delete;
+    CountedError& operator=(CountedError&& other) = default;
+};
+
+using CountedResult = Result<int, CountedError>;
+
+CountedResult failing() {
+    return Err(CountedError("this message is long enough to not fit into the small buffer"));
+}
+
+CountedResult succeeding() {
+    return Ok(1);
+}
+
+TEST_CASE("Chain") {
+    SECTION("Err is moved") {
+        Counters::reset();
+
+        auto res = failing()
+                       .map([](int a) {
+                           return a + 1;
+                       })
+                       .andThen([](int a) -> CountedResult {
+                           return Ok(a + 1);
+                       })
+                       .and_(succeeding())
+                       .mapErr([](CountedError err) {
+                           return err;
+                       })
+                       .map([]() {
+                           return 2;
+                       })
+                       .andThen([]() {
+                           return succeeding();
+                       })
+                       .orElse([](CountedError err) -> CountedResult {
+                           return Err(std::move(err));
+                       })
+                       .map([](int a) -> CountedResult {
+                           return Ok(a);
+                       })
+                       .flatten()
+                       .map([](int a) {
+                           return std::optional<int>(a);
+                       })
+                       .transpose();
+
+        REQUIRE(Counters::copies == 0);
+        REQUIRE(Counters::allocations == 1);
+        REQUIRE(res.has_value());
+        REQUIRE(res->isErr());
+        REQUIRE(res->unwrapErr().message == "this message is long enough to not fit into the small buffer");
+    }
+
+    SECTION("Ok is moved") {
+        Counters::reset();
+
+        auto res = Result<CountedError, int>(Ok(CountedError("this message is long enough to not fit into the small buffer")))
+                       .map([](CountedError ok) {
+                           return ok;
+                       })
+                       .mapErr([](int a) {
+                           return a + 1;
+                       })
+                       .or_(Result<CountedError, int>(Err(2)))
+                       .orElse([](int a) -> Result<CountedError, int> {
+                           return Err(a);
+                       })
+                       .andThen([](CountedError ok) -> Result<CountedError, int> {
+                           return Ok(std::move(ok));
+                       })
+                       .mapErr([]() {
+                           return 3;
+                       })
+                       .map([](CountedError ok) {
+                           return std::optional<CountedError>(std::move(ok));
+                       })
+                       .transpose()
+                       .value()
+                       .map([](CountedError ok) -> Result<CountedError, int> {
+                           return Ok(std::move(ok));
+                       })
+                       .flatten();
+
+        REQUIRE(Counters::copies == 0);
+        REQUIRE(Counters::allocations == 1);
+        REQUIRE(res.isOk());
+        REQUIRE(res.unwrap().message == "this message is long enough to not fit into the small buffer");
+    }
+
+    SECTION("Lvalues are copied") {
+        auto res = failing();
+        Counters::reset();
+
+        auto res2 = res.map([](int a) {
+            return a + 1;
+        });
+
+        REQUIRE(Counters::copies == 1);
+        REQUIRE(res.isErr());
+        REQUIRE(res2.isErr());
+    }
+}
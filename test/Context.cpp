@@ -0,0 +1,132 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Arena.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <sstream>
+
+using namespace geode;
+
+static constexpr char contextMessage[] = "reading file";
+
+Result<int, std::string> contextParse(std::string_view str) {
+    if (str.empty()) {
+        return Err("empty input");
+    }
+    return Ok(static_cast<int>(str.size()));
+}
+
+Result<int, ContextError> contextLoad(std::string_view str) {
+    GEODE_UNWRAP_INTO(int value, contextParse(str).context(contextMessage));
+    return Ok(value);
+}
+
+Result<int, ContextError> contextConfig(std::string_view str) {
+    GEODE_UNWRAP_INTO(int value, contextLoad(str).context("loading config"));
+    return Ok(value * 2);
+}
+
+TEST_CASE("Context") {
+    SECTION("Ok") {
+        auto res = contextConfig("abc");
+        REQUIRE(res.unwrap() == 6);
+    }
+
+    SECTION("Err") {
+        auto res = contextConfig("");
+        REQUIRE(res.isErr());
+        auto& err = res.unwrapErr();
+        REQUIRE(err.depth() == 2);
+        REQUIRE(err.root() == "empty input");
+        REQUIRE(err.frame(0) == "loading config");
+        REQUIRE(err.frame(1) == "reading file");
+        REQUIRE(err == "loading config: reading file: empty input");
+        REQUIRE(std::string(err) == "loading config: reading file: empty input");
+    }
+
+    SECTION("Literals") {
+        auto res = contextLoad("");
+        REQUIRE(res.unwrapErr().frame(0).data() == contextMessage);
+    }
+
+    SECTION("Deep") {
+        Result<int, ContextError> res = Err("root");
+        std::string expected = "root";
+        // past the inline frames and across several overflow chunks
+        for (int i = 0; i < 21; ++i) {
+            res = std::move(res).context("layer " + std::to_string(i));
+            expected = "layer " + std::to_string(i) + ": " + expected;
+        }
+        auto& err = res.unwrapErr();
+        REQUIRE(err.depth() == 21);
+        bool ordered = true;
+        for (std::size_t i = 0; i < err.depth(); ++i) {
+            ordered = ordered && err.frame(i) == "layer " + std::to_string(20 - i);
+        }
+        REQUIRE(ordered);
+        REQUIRE(err == expected);
+
+        auto copy = err;
+        REQUIRE(copy == expected);
+        auto moved = std::move(copy);
+        REQUIRE(moved == expected);
+        REQUIRE(copy.depth() == 0);
+
+        copy = moved;
+        REQUIRE(copy == expected);
+    }
+
+    SECTION("Copy Assignment Failure") {
+        ContextError deep("root");
+        for (int i = 0; i < 21; ++i) {
+            deep.context("layer");
+        }
+        ContextError target = ContextError("target").context("outer");
+        {
+            // every chunk allocation throws
+            ErrorArena::Scope scope(std::pmr::null_memory_resource());
+            REQUIRE_THROWS_AS(target = deep, std::bad_alloc);
+        }
+        REQUIRE(target.depth() == 1);
+        REQUIRE(target == "outer: target");
+        target = deep;
+        REQUIRE(target.depth() == 21);
+    }
+
+    SECTION("Lazy") {
+        int calls = 0;
+        auto frame = [&] {
+            ++calls;
+            return std::string("computed");
+        };
+        REQUIRE(contextParse("a").context(frame).unwrap() == 1);
+        REQUIRE(calls == 0);
+        REQUIRE(contextParse("").context(frame).unwrapErr() == "computed: empty input");
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("Lvalue") {
+        Result<int, ContextError> res = Err("root");
+        auto outer = res.context("outer");
+        REQUIRE(outer.unwrapErr() == "outer: root");
+        REQUIRE(res.unwrapErr() == "root");
+    }
+
+    SECTION("Void") {
+        Result<void, std::string> res = Err("failed");
+        REQUIRE(std::move(res).context("checking").unwrapErr() == "checking: failed");
+        Result<void, std::string> ok = Ok();
+        REQUIRE(std::move(ok).context("checking").isOk());
+    }
+
+    SECTION("Stream") {
+        Result<int, ContextError> res = Err("root");
+        for (int i = 0; i < 6; ++i) {
+            res = std::move(res).context("layer");
+        }
+        std::ostringstream stream;
+        stream << res.unwrapErr();
+        REQUIRE(stream.str() == res.unwrapErr().message());
+    }
+}
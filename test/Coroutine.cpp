@@ -0,0 +1,196 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Coroutine.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <memory>
+#include <stdexcept>
+
+using namespace geode;
+
+Result<int, std::string> coDivide(int a, int b) {
+    if (b == 0) {
+        co_return Err("Division by zero");
+    }
+    co_return Ok(a / b);
+}
+
+Result<int, std::string> coDivideTwice(int a, int b) {
+    int first = co_await coDivide(a, b);
+    int second = co_await coDivide(first, b);
+    co_return Ok(second);
+}
+
+// Err types convert like they do when returning an ErrContainer
+Result<int, char const*> coParseDigit(char c) {
+    if (c < '0' || c > '9') {
+        co_return Err("Not a digit");
+    }
+    co_return Ok(c - '0');
+}
+
+Result<int, std::string> coParseNumber(std::string_view str) {
+    int value = 0;
+    for (auto c : str) {
+        value = value * 10 + co_await coParseDigit(c);
+    }
+    co_return Ok(value);
+}
+
+Result<void, std::string> coCheckPositive(int value) {
+    if (value <= 0) {
+        co_return Err("Not positive");
+    }
+    co_return Ok();
+}
+
+Result<int, std::string> coCheckThenDivide(int a, int b) {
+    co_await coCheckPositive(b);
+    co_return Ok(a / b);
+}
+
+Result<int, std::string> coUnwrapMacro(int a, int b) {
+    GEODE_CO_UNWRAP_INTO(int value, coDivide(a, b));
+    co_return Ok(value + 1);
+}
+
+struct CoCounter {
+    int* count;
+
+    CoCounter(int* count) : count(count) {}
+
+    ~CoCounter() {
+        *count += 1;
+    }
+};
+
+Result<int, std::string> coDestroysLocals(int* count, int b) {
+    CoCounter counter(count);
+    int value = co_await coDivide(10, b);
+    co_return Ok(value);
+}
+
+Result<std::unique_ptr<int>, std::string> coMakeUnique(int value) {
+    co_return Ok(std::make_unique<int>(value));
+}
+
+Result<int, std::string> coMoveOnly(int value) {
+    auto ptr = co_await coMakeUnique(value);
+    co_return Ok(*ptr);
+}
+
+Result<int, std::string> coAwaitLvalue(Result<int, std::string> const& res) {
+    auto const& value = co_await res;
+    co_return Ok(value * 2);
+}
+
+Result<int, std::string> coThrows(int value) {
+    if (value < 0) {
+        throw std::runtime_error("negative");
+    }
+    co_return Ok(value);
+}
+
+Result<int, std::string> coThrowsNested(int* count, int value) {
+    CoCounter counter(count);
+    int first = co_await coDivide(value, 1);
+    co_return Ok(co_await coThrows(-first));
+}
+
+Result<int, std::string> coRecurse(int depth) {
+    if (depth == 0) {
+        co_return Ok(0);
+    }
+    co_return Ok(co_await coRecurse(depth - 1) + 1);
+}
+
+Result<int, std::string> coThrowsDeep(int depth) {
+    if (depth == 0) {
+        throw std::runtime_error("Too deep");
+    }
+    co_return Ok(co_await coThrowsDeep(depth - 1) + 1);
+}
+
+TEST_CASE("Coroutine") {
+    SECTION("Ok") {
+        auto res = coDivideTwice(32, 2);
+        REQUIRE(res.isOk());
+        REQUIRE(res.unwrap() == 8);
+    }
+
+    SECTION("Err") {
+        auto res = coDivideTwice(32, 0);
+        REQUIRE(res.isErr());
+        REQUIRE(res.unwrapErr() == "Division by zero");
+    }
+
+    SECTION("Err Conversion") {
+        REQUIRE(coParseNumber("1234").unwrap() == 1234);
+        REQUIRE(coParseNumber("12a4").unwrapErr() == "Not a digit");
+    }
+
+    SECTION("Void") {
+        REQUIRE(coCheckThenDivide(10, 2).unwrap() == 5);
+        REQUIRE(coCheckThenDivide(10, -2).unwrapErr() == "Not positive");
+    }
+
+    SECTION("Macro") {
+        REQUIRE(coUnwrapMacro(10, 2).unwrap() == 6);
+        REQUIRE(coUnwrapMacro(10, 0).unwrapErr() == "Division by zero");
+    }
+
+    SECTION("Locals") {
+        int count = 0;
+        REQUIRE(coDestroysLocals(&count, 2).unwrap() == 5);
+        REQUIRE(count == 1);
+        REQUIRE(coDestroysLocals(&count, 0).isErr());
+        REQUIRE(count == 2);
+    }
+
+    SECTION("Move Only") {
+        REQUIRE(coMoveOnly(7).unwrap() == 7);
+    }
+
+    SECTION("Lvalue") {
+        Result<int, std::string> ok = Ok(21);
+        Result<int, std::string> err = Err("Error");
+        REQUIRE(coAwaitLvalue(ok).unwrap() == 42);
+        REQUIRE(coAwaitLvalue(err).unwrapErr() == "Error");
+        REQUIRE(err.unwrapErr() == "Error");
+    }
+
+    SECTION("Exceptions") {
+        REQUIRE(coThrows(1).unwrap() == 1);
+        REQUIRE_THROWS_AS(coThrows(-1), std::runtime_error);
+        REQUIRE(impl::ResultFrameArena::current().used() == 0);
+
+        // the exception leaves through every frame, destroying their locals
+        int count = 0;
+        REQUIRE_THROWS_AS(coThrowsNested(&count, 3), std::runtime_error);
+        REQUIRE(count == 1);
+        REQUIRE(impl::ResultFrameArena::current().used() == 0);
+        REQUIRE(coThrowsNested(&count, -3).unwrap() == 3);
+        REQUIRE(count == 2);
+    }
+
+    SECTION("Exception Frame Frees") {
+        auto& arena = impl::ResultFrameArena::current();
+        REQUIRE(arena.frames() == 0);
+        // every frame is freed exactly once, a leaked one would be counted and a
+        // frame freed twice would wrap the count around
+        REQUIRE_THROWS_AS(coThrows(-1), std::runtime_error);
+        REQUIRE(arena.frames() == 0);
+        // deep enough for the outer frames to be in the arena and the inner ones
+        // on the heap
+        REQUIRE_THROWS_AS(coThrowsDeep(1000), std::runtime_error);
+        REQUIRE(arena.frames() == 0);
+        REQUIRE(arena.used() == 0);
+    }
+
+    SECTION("Frames") {
+        REQUIRE(coRecurse(1000).unwrap() == 1000);
+        REQUIRE(coDivideTwice(32, 0).isErr());
+        REQUIRE(impl::ResultFrameArena::current().used() == 0);
+    }
+}
@@ -0,0 +1,108 @@
+#include <Geode/Result.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+using namespace geode;
+
+static_assert(sizeof(Error) == sizeof(void*), "Expected Error to be pointer sized");
+static_assert(sizeof(Result<int, Error>) == 16, "Expected Result<int, Error> to be 16 bytes");
+
+static constexpr char divisionMessage[] = "Division by zero, which is not allowed for integers";
+
+Result<int, Error> divideError(int a, int b) {
+    if (b == 0) {
+        return Err(divisionMessage);
+    }
+    return Ok(a / b);
+}
+
+Result<int, Error> parseError(std::string const& str) {
+    return Err("Could not parse " + str);
+}
+
+TEST_CASE("Error") {
+    SECTION("Literal") {
+        auto res = divideError(32, 0);
+        auto copy = res.unwrapErr();
+
+        REQUIRE(res.unwrapErr() == "Division by zero, which is not allowed for integers");
+#if GEODE_RESULT_REFERENCE_LITERALS
+        REQUIRE(res.unwrapErr().message().data() == divisionMessage);
+        REQUIRE(copy.message().data() == divisionMessage);
+#else
+        REQUIRE(res.unwrapErr().message().data() != divisionMessage);
+        REQUIRE(copy.message().data() == res.unwrapErr().message().data());
+#endif
+    }
+
+    SECTION("Literal Size") {
+        Error error = "abc";
+        REQUIRE(error.message().size() == 3);
+        REQUIRE(error == "abc");
+
+        static constexpr char unterminated[] = {'a', 'b', 'c'};
+        Error copied = unterminated;
+        REQUIRE(copied.message().size() == 3);
+        REQUIRE(copied == "abc");
+
+        Error empty = "";
+        REQUIRE(empty.message().empty());
+    }
+
+    SECTION("Owned") {
+        auto res = parseError("some string that is long enough to allocate");
+        auto copy = res.unwrapErr();
+
+        REQUIRE(copy == "Could not parse some string that is long enough to allocate");
+        REQUIRE(copy.message().data() == res.unwrapErr().message().data());
+    }
+
+    SECTION("Empty") {
+        Error error;
+        REQUIRE(error.message().empty());
+        REQUIRE(error == "");
+    }
+
+    SECTION("Buffer") {
+        char buffer[] = "mutable";
+        Error error = buffer;
+        buffer[0] = 'M';
+        REQUIRE(error == "mutable");
+    }
+
+    SECTION("Conversions") {
+        Error error = std::string("from string");
+        std::string str = error;
+        REQUIRE(str == "from string");
+
+        std::string_view view = error;
+        REQUIRE(view == "from string");
+
+        Result<void, Error> res = Err(std::string("from string"));
+        REQUIRE(res.unwrapErr() == "from string");
+    }
+
+    SECTION("Assignment") {
+        Error error = std::string("first");
+        Error other = "second";
+        error = other;
+        REQUIRE(error == "second");
+
+        other = std::string("third");
+        error = std::move(other);
+        REQUIRE(error == "third");
+        REQUIRE(other == "");
+    }
+
+    SECTION("Exceptions") {
+        auto res = divideError(32, 0);
+        try {
+            res.unwrap();
+            FAIL("Expected UnwrapException to be thrown");
+        }
+        catch (UnwrapException const& e) {
+            REQUIRE(e.what() == std::string("Called unwrap on an Err Result: Division by zero, which is not allowed for integers"));
+        }
+    }
+}
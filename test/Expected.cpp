@@ -0,0 +1,135 @@
+// Built as its own C++23 executable, since std::expected needs it
+#include <Geode/Result.hpp>
+#include <Geode/result/Expected.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+using namespace geode;
+
+// counts how often a payload is moved and copied on its way through a conversion
+struct ExpectedPayload {
+    static inline int moves = 0;
+    static inline int copies = 0;
+
+    int value;
+
+    ExpectedPayload(int value) : value(value) {}
+
+    ExpectedPayload(ExpectedPayload const& other) : value(other.value) {
+        ++copies;
+    }
+
+    ExpectedPayload(ExpectedPayload&& other) noexcept : value(other.value) {
+        ++moves;
+    }
+
+    ExpectedPayload& operator=(ExpectedPayload const&) = default;
+    ExpectedPayload& operator=(ExpectedPayload&&) = default;
+
+    static void reset() {
+        moves = 0;
+        copies = 0;
+    }
+};
+
+std::expected<int, std::string> expectedHalve(int value) {
+    if (value % 2 != 0) {
+        return std::unexpected("odd");
+    }
+    return value / 2;
+}
+
+std::expected<void, std::string> expectedCheck(bool ok) {
+    if (!ok) {
+        return std::unexpected("failed check");
+    }
+    return {};
+}
+
+Result<int, std::string> expectedQuarter(int value) {
+    int half = GEODE_UNWRAP(expectedHalve(value));
+    GEODE_UNWRAP_INTO(int quarter, expectedHalve(half));
+    GEODE_UNWRAP(expectedCheck(quarter != 0));
+    return Ok(quarter);
+}
+
+constexpr int expectedConstant() {
+    Result<int, int> res = Err(4);
+    return fromExpected(toExpected(std::move(res))).unwrapErr();
+}
+
+TEST_CASE("Expected") {
+    SECTION("Ok") {
+        Result<int, std::string> res = Ok(5);
+        auto expected = toExpected(std::move(res));
+        static_assert(std::same_as<decltype(expected), std::expected<int, std::string>>);
+        REQUIRE(expected.value() == 5);
+        REQUIRE(fromExpected(std::move(expected)).unwrap() == 5);
+    }
+
+    SECTION("Err") {
+        Result<int, std::string> res = Err("failed");
+        auto expected = toExpected(res);
+        REQUIRE(expected.error() == "failed");
+        REQUIRE(res.unwrapErr() == "failed");
+        auto back = fromExpected(expected);
+        REQUIRE(back.unwrapErr() == "failed");
+        REQUIRE(expected.error() == "failed");
+    }
+
+    SECTION("Void") {
+        Result<void, std::string> ok = Ok();
+        REQUIRE(toExpected(ok).has_value());
+        Result<void, std::string> err = Err("failed");
+        REQUIRE(toExpected(err).error() == "failed");
+        REQUIRE(fromExpected(std::expected<void, std::string>()).isOk());
+        REQUIRE(fromExpected(std::expected<void, std::string>(std::unexpect, "failed")).unwrapErr() == "failed");
+
+        Result<int, void> voidErr = Err();
+        auto expected = toExpected(voidErr);
+        static_assert(std::same_as<decltype(expected), std::expected<int, std::monostate>>);
+        REQUIRE(!expected.has_value());
+    }
+
+    SECTION("References") {
+        int value = 3;
+        Result<int&, std::string> res = Ok(value);
+        auto expected = toExpected(res);
+        static_assert(std::same_as<decltype(expected), std::expected<std::reference_wrapper<int>, std::string>>);
+        expected.value().get() = 4;
+        REQUIRE(value == 4);
+
+        std::string error = "referenced";
+        Result<int, std::string&> errRes = Err(error);
+        REQUIRE(&toExpected(errRes).error().get() == &error);
+    }
+
+    SECTION("Single Move") {
+        Result<ExpectedPayload, ExpectedPayload> ok = Ok(ExpectedPayload(1));
+        Result<ExpectedPayload, ExpectedPayload> err = Err(ExpectedPayload(2));
+
+        ExpectedPayload::reset();
+        auto expected = toExpected(std::move(ok));
+        REQUIRE(ExpectedPayload::moves == 1);
+        auto back = fromExpected(std::move(expected));
+        REQUIRE(ExpectedPayload::moves == 2);
+        REQUIRE(back.unwrap().value == 1);
+
+        ExpectedPayload::reset();
+        auto roundTrip = fromExpected(toExpected(std::move(err)));
+        REQUIRE(ExpectedPayload::moves == 2);
+        REQUIRE(ExpectedPayload::copies == 0);
+        REQUIRE(roundTrip.unwrapErr().value == 2);
+    }
+
+    SECTION("Unwrap") {
+        REQUIRE(expectedQuarter(8).unwrap() == 2);
+        REQUIRE(expectedQuarter(6).unwrapErr() == "odd");
+        REQUIRE(expectedQuarter(0).unwrapErr() == "failed check");
+    }
+
+    SECTION("Constant Evaluation") {
+        static_assert(expectedConstant() == 4);
+    }
+}
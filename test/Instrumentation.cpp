@@ -0,0 +1,115 @@
+// Built as its own executable with GEODE_RESULT_INSTRUMENTATION defined, since
+// the hook has to be enabled for the whole program
+#include <Geode/Result.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace geode;
+
+static constexpr std::uint32_t parseErrLine = __LINE__ + 3;
+Result<int, std::string> instrumentedParse(std::string_view str) {
+    if (str.empty()) {
+        return Err("empty input");
+    }
+    return Ok(static_cast<int>(str.size()));
+}
+
+Result<int, std::string> instrumentedLoad(std::string_view str) {
+    GEODE_UNWRAP_INTO(int value, instrumentedParse(str));
+    return Ok(value * 2);
+}
+
+static constexpr std::uint32_t checkErrLine = __LINE__ + 3;
+Result<void, void> instrumentedCheck(bool ok) {
+    if (!ok) {
+        return Err();
+    }
+    return Ok();
+}
+
+constexpr int constantErr() {
+    Result<int, int> res = Err(3);
+    return res.unwrapErr();
+}
+
+bool isInstrumentedSite(instrumentation::ErrSite const& site, std::uint32_t line) {
+    return std::string_view(site.file).ends_with("Instrumentation.cpp") && site.line == line;
+}
+
+TEST_CASE("Instrumentation") {
+    instrumentation::reset();
+
+    SECTION("Sites") {
+        for (int i = 0; i < 3; ++i) {
+            REQUIRE(instrumentedParse("").isErr());
+        }
+        REQUIRE(instrumentedCheck(false).isErr());
+        auto sites = instrumentation::sites();
+        REQUIRE(sites.size() == 2);
+        REQUIRE(isInstrumentedSite(sites[0], parseErrLine));
+        REQUIRE(sites[0].count == 3);
+        REQUIRE(isInstrumentedSite(sites[1], checkErrLine));
+        REQUIRE(sites[1].count == 1);
+        REQUIRE(instrumentation::total() == 4);
+    }
+
+    SECTION("Ok") {
+        REQUIRE(instrumentedParse("abc").isOk());
+        REQUIRE(instrumentedCheck(true).isOk());
+        REQUIRE(instrumentation::total() == 0);
+    }
+
+    SECTION("Propagation") {
+        auto res = instrumentedLoad("");
+        REQUIRE(res.isErr());
+        auto mapped = res.mapErr([](std::string const& err) { return err.size(); });
+        auto ref = res.asRef();
+        auto context = res.context("loading");
+        auto copied = ref.copied();
+        REQUIRE(instrumentation::total() == 1);
+        REQUIRE(isInstrumentedSite(instrumentation::sites()[0], parseErrLine));
+    }
+
+    SECTION("Threads") {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([] {
+                for (int i = 0; i < 1000; ++i) {
+                    (void)instrumentedParse("");
+                }
+            });
+        }
+        threads.clear();
+        REQUIRE(instrumentation::total() == 4000);
+        REQUIRE(instrumentation::sites().size() == 1);
+    }
+
+    SECTION("Dump") {
+        (void)instrumentedParse("");
+        (void)instrumentedParse("");
+        std::ostringstream stream;
+        instrumentation::dump(stream);
+        auto line = stream.str();
+        REQUIRE(line.starts_with("2 "));
+        REQUIRE(line.find("Instrumentation.cpp:" + std::to_string(parseErrLine) + ":") != std::string::npos);
+        REQUIRE(line.find("instrumentedParse") != std::string::npos);
+        REQUIRE(line.ends_with("\n"));
+    }
+
+    SECTION("Reset") {
+        (void)instrumentedParse("");
+        instrumentation::reset();
+        REQUIRE(instrumentation::total() == 0);
+        REQUIRE(instrumentation::sites().empty());
+    }
+
+    SECTION("Constant Evaluation") {
+        static_assert(constantErr() == 3);
+        REQUIRE(instrumentation::total() == 0);
+    }
+}
@@ -0,0 +1,123 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Mapped.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <algorithm>
+#include <string>
+
+using namespace geode;
+
+#if defined(GEODE_RESULT_IMPL_POSIX)
+namespace {
+    struct TempFile {
+        char path[32] = "/tmp/geode-result-mapped-XXXXXX";
+
+        explicit TempFile(std::string_view contents) {
+            int fd = ::mkstemp(path);
+            (void)sys::write(fd, contents.data(), contents.size());
+            (void)sys::close(fd);
+        }
+
+        ~TempFile() {
+            ::unlink(path);
+        }
+    };
+
+    struct Header {
+        std::string_view magic;
+        std::string_view body;
+    };
+
+    Result<Header, Errno> parseHeader(MappedFile const& file) {
+        auto text = file.text();
+        auto end = text.find('\n');
+        if (end == std::string_view::npos) {
+            return Err(Errno(EINVAL));
+        }
+        return Ok(Header{text.substr(0, end), text.substr(end + 1)});
+    }
+}
+
+TEST_CASE("Mapped") {
+    SECTION("Contents") {
+        TempFile temp("hello mapped world");
+        auto file = MappedFile::open(temp.path).unwrap();
+        REQUIRE(file.size() == 18);
+        REQUIRE(!file.empty());
+        REQUIRE(file.text() == "hello mapped world");
+        auto bytes = file.bytes();
+        REQUIRE(bytes.size() == 18);
+        REQUIRE(bytes[0] == std::byte('h'));
+        REQUIRE(bytes.data() == file.data());
+    }
+
+    SECTION("Missing File") {
+        auto res = MappedFile::open("/nonexistent/geode/result");
+        REQUIRE(res.unwrapErr() == ENOENT);
+    }
+
+    SECTION("Empty File") {
+        TempFile temp("");
+        auto file = MappedFile::open(temp.path).unwrap();
+        REQUIRE(file.empty());
+        REQUIRE(file.bytes().empty());
+        REQUIRE(file.text().empty());
+        REQUIRE(file.advise({.sequential = true}).isOk());
+    }
+
+    SECTION("Advice") {
+        TempFile temp(std::string(8192, 'a'));
+        auto file = MappedFile::open(temp.path, {.sequential = true, .willNeed = true}).unwrap();
+        REQUIRE(std::all_of(file.text().begin(), file.text().end(), [](char c) { return c == 'a'; }));
+        REQUIRE(file.advise({.random = true}).isOk());
+        // huge pages are only a hint, and mapping succeeds where they are not supported
+        REQUIRE(MappedFile::open(temp.path, {.hugePage = true}).isOk());
+    }
+
+    SECTION("Descriptor") {
+        TempFile temp("descriptor");
+        int fd = sys::open(temp.path, O_RDONLY).unwrap();
+        auto file = MappedFile::map(fd);
+        REQUIRE(sys::close(fd).isOk());
+        REQUIRE(file.unwrap().text() == "descriptor");
+        REQUIRE(MappedFile::map(fd).unwrapErr() == EBADF);
+    }
+
+    SECTION("Pipeline") {
+        TempFile temp("GEODE\npayload");
+        // the file is kept alive alongside the views into it
+        auto res = MappedFile::open(temp.path).andThen([](MappedFile&& file) -> Result<std::pair<MappedFile, Header>, Errno> {
+            GEODE_UNWRAP_INTO(auto header, parseHeader(file));
+            return Ok(std::pair{std::move(file), header});
+        });
+        auto [file, header] = std::move(res).unwrap();
+        REQUIRE(header.magic == "GEODE");
+        REQUIRE(header.body == "payload");
+        REQUIRE(header.body.data() == file.text().data() + 6);
+
+        TempFile invalid("no header");
+        auto failed = MappedFile::open(invalid.path).andThen([](MappedFile&& file) {
+            return parseHeader(file).map([](Header header) {
+                return header.body.size();
+            });
+        });
+        REQUIRE(failed.unwrapErr() == EINVAL);
+    }
+
+    SECTION("Move") {
+        TempFile temp("moved");
+        auto file = MappedFile::open(temp.path).unwrap();
+        auto data = file.data();
+        MappedFile other = std::move(file);
+        REQUIRE(file.empty());
+        REQUIRE(file.data() == nullptr);
+        REQUIRE(other.data() == data);
+        other = MappedFile::open(temp.path).unwrap();
+        REQUIRE(other.text() == "moved");
+        other = MappedFile();
+        REQUIRE(other.empty());
+    }
+}
+#endif
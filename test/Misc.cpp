@@ -14,6 +14,83 @@ constexpr Result<int, int> divideConstexpr(int a, int b) {
     }
 }
 
+// A literal type with user-provided special members, so that the non-trivial
+// storage paths of Result are evaluated at compile time too
+struct ConstexprBox {
+    int value;
+
+    constexpr ConstexprBox(int value) : value(value) {}
+    constexpr ConstexprBox(ConstexprBox const& other) : value(other.value) {}
+    constexpr ConstexprBox(ConstexprBox&& other) : value(other.value) {
+        other.value = 0;
+    }
+    constexpr ConstexprBox& operator=(ConstexprBox const& other) {
+        value = other.value;
+        return *this;
+    }
+    constexpr ConstexprBox& operator=(ConstexprBox&& other) {
+        value = other.value;
+        other.value = 0;
+        return *this;
+    }
+    constexpr ~ConstexprBox() {}
+
+    constexpr bool operator==(ConstexprBox const&) const = default;
+};
+
+using ConstexprBoxResult = Result<ConstexprBox, ConstexprBox>;
+
+constexpr bool constexprCopyConstruct() {
+    ConstexprBoxResult res = Ok(ConstexprBox(4));
+    ConstexprBoxResult copy = res;
+    return copy.unwrap().value == 4 && res.unwrap().value == 4;
+}
+
+constexpr bool constexprCopyAssign() {
+    ConstexprBoxResult res = Ok(ConstexprBox(4));
+    ConstexprBoxResult other = Err(ConstexprBox(8));
+    other = res;
+    ConstexprBoxResult err = Err(ConstexprBox(16));
+    res = err;
+    Result<void, int> voidRes = Ok();
+    Result<void, int> voidErr = Err(3);
+    voidRes = voidErr;
+    return other.unwrap().value == 4 && res.unwrapErr().value == 16 && err.unwrapErr().value == 16 &&
+        voidRes.unwrapErr() == 3;
+}
+
+constexpr bool constexprMoveConstruct() {
+    ConstexprBoxResult res = Ok(ConstexprBox(4));
+    ConstexprBoxResult moved = std::move(res);
+    return moved.unwrap().value == 4;
+}
+
+constexpr bool constexprMoveAssign() {
+    ConstexprBoxResult res = Ok(ConstexprBox(4));
+    ConstexprBoxResult other = Err(ConstexprBox(8));
+    other = std::move(res);
+    ConstexprBoxResult same = Ok(ConstexprBox(2));
+    same = ConstexprBoxResult(Ok(ConstexprBox(3)));
+    return other.unwrap().value == 4 && same.unwrap().value == 3;
+}
+
+constexpr bool constexprStringErr() {
+    Result<int, std::string> res = Err(std::string("a constexpr error that does not fit inline"));
+    Result<int, std::string> copy = Ok(1);
+    copy = res;
+    return copy.unwrapErr().size() == 42 && res.mapErr([](std::string const& err) {
+        return err.size();
+    }).unwrapErr() == 42;
+}
+
+// A lookup table computed at compile time
+constexpr Result<int, int> constexprTable[] = {
+    divideConstexpr(8, 1),
+    divideConstexpr(8, 2),
+    divideConstexpr(8, 0),
+    divideConstexpr(8, 4),
+};
+
 Result<int const&, std::string> divideConstRef(int a, int b) {
     if (b == 0) {
         return Err("Division by zero");
@@ -152,6 +229,29 @@ TEST_CASE("Misc") {
         }
     }
 
+    SECTION("Trivially Copyable") {
+        static_assert(std::is_trivially_copyable_v<Result<int, int>>, "Expected Result<int, int> to be trivially copyable");
+        static_assert(std::is_trivially_destructible_v<Result<int, int>>, "Expected Result<int, int> to be trivially destructible");
+        static_assert(std::is_trivially_copyable_v<Result<void, int>>, "Expected Result<void, int> to be trivially copyable");
+        static_assert(std::is_trivially_copyable_v<Result<int, void>>, "Expected Result<int, void> to be trivially copyable");
+        static_assert(std::is_trivially_copyable_v<Result<void, void>>, "Expected Result<void, void> to be trivially copyable");
+        static_assert(std::is_trivially_copyable_v<Result<int const&, int&>>, "Expected Result<int const&, int&> to be trivially copyable");
+        static_assert(std::is_trivially_destructible_v<Result<int const&, void>>, "Expected Result<int const&, void> to be trivially destructible");
+
+        static_assert(!std::is_trivially_copyable_v<Result<int, std::string>>, "Expected Result<int, std::string> to not be trivially copyable");
+        static_assert(!std::is_trivially_destructible_v<Result<int, std::string>>, "Expected Result<int, std::string> to not be trivially destructible");
+        static_assert(std::is_nothrow_move_constructible_v<Result<int, std::string>>, "Expected Result<int, std::string> to be nothrow move constructible");
+        static_assert(std::is_copy_constructible_v<Result<int, std::string>>, "Expected Result<int, std::string> to be copy constructible");
+
+        auto res = divideConstexpr(32, 2);
+        auto copy = res;
+        REQUIRE(copy.unwrap() == 16);
+
+        auto voidRes = divideVoidOkVoidErr(32, 0);
+        auto voidCopy = voidRes;
+        REQUIRE(voidCopy.isErr());
+    }
+
     SECTION("Exceptions") {
         SECTION("Ok") {
             auto res = divideConstexpr(32, 2);
@@ -178,6 +278,33 @@ TEST_CASE("Misc") {
         }
     }
 
+    SECTION("Exception Messages") {
+        enum class Code {
+            First,
+            Second,
+        };
+        struct Opaque {};
+
+        auto message = [](auto&& res) {
+            try {
+                res.unwrap();
+            }
+            catch (UnwrapException const& e) {
+                return std::string(e.what());
+            }
+            return std::string();
+        };
+
+        REQUIRE(message(Result<int, float>(Err(1.5f))) == "Called unwrap on an Err Result: 1.5");
+        REQUIRE(message(Result<int, double>(Err(1.0 / 3.0))) == "Called unwrap on an Err Result: 0.333333");
+        REQUIRE(message(Result<int, char>(Err('x'))) == "Called unwrap on an Err Result: x");
+        REQUIRE(message(Result<int, bool>(Err(true))) == "Called unwrap on an Err Result: 1");
+        REQUIRE(message(Result<int, std::string>(Err("text"))) == "Called unwrap on an Err Result: text");
+        REQUIRE(message(Result<int, Code>(Err(Code::Second))) == "Called unwrap on an Err Result: 1");
+        REQUIRE(message(Result<int, Opaque>(Err(Opaque()))) == "Called unwrap on an Err Result");
+        REQUIRE(message(Result<int, void>(Err())) == "Called unwrap on an Err Result");
+    }
+
     SECTION("Unwrap If Macros") {
         SECTION("Ok") {
             auto res = divideConstexpr(32, 2);
@@ -264,3 +391,75 @@ TEST_CASE("Misc") {
         REQUIRE(*res == 16);
     }
 }
+
+TEST_CASE("Constexpr") {
+    SECTION("Special Members") {
+        static_assert(constexprCopyConstruct(), "Expected copy construction to be constexpr");
+        static_assert(constexprCopyAssign(), "Expected copy assignment to be constexpr");
+        static_assert(constexprMoveConstruct(), "Expected move construction to be constexpr");
+        static_assert(constexprMoveAssign(), "Expected move assignment to be constexpr");
+        static_assert(constexprStringErr(), "Expected Result<int, std::string> to be usable in constexpr");
+        static_assert(std::is_copy_assignable_v<Result<int, std::string>>, "Expected Result<int, std::string> to be copy assignable");
+        static_assert(std::is_trivially_copy_assignable_v<Result<int, int>>, "Expected Result<int, int> to be trivially copy assignable");
+    }
+
+    SECTION("Table") {
+        static_assert(constexprTable[1].unwrap() == 4, "Expected table entry to be 4");
+        static_assert(constexprTable[2].unwrapErr() == -1, "Expected table entry to be Err");
+        static_assert(constexprTable[3] == Ok(2), "Expected table entry to be 2");
+    }
+
+    SECTION("Unwrap") {
+        static_assert(divideConstexpr(8, 2).unwrapOr(0) == 4, "Expected unwrapOr to return the Ok value");
+        static_assert(divideConstexpr(8, 0).unwrapOr(7) == 7, "Expected unwrapOr to return the default");
+        static_assert(divideConstexpr(8, 0).unwrapOrDefault() == 0, "Expected unwrapOrDefault to return 0");
+        static_assert(divideConstexpr(8, 0).unwrapOrElse([] { return 9; }) == 9, "Expected unwrapOrElse to call the function");
+        static_assert(*divideConstexpr(8, 2) == 4, "Expected operator* to return the Ok value");
+        static_assert(divideConstexpr(8, 2).ok() == 4, "Expected ok to return the Ok value");
+        static_assert(!divideConstexpr(8, 2).err(), "Expected err to be empty");
+        static_assert(divideConstexpr(8, 0).err() == -1, "Expected err to return the Err value");
+        static_assert(divideConstexpr(8, 2), "Expected operator bool to be true");
+    }
+
+    SECTION("Map") {
+        constexpr auto twice = [](int value) {
+            return value * 2;
+        };
+        static_assert(divideConstexpr(8, 2).map(twice).unwrap() == 8, "Expected map to map the Ok value");
+        static_assert(divideConstexpr(8, 0).mapErr(twice).unwrapErr() == -2, "Expected mapErr to map the Err value");
+        static_assert(divideConstexpr(8, 2).mapOr(0, twice) == 8, "Expected mapOr to map the Ok value");
+        static_assert(divideConstexpr(8, 0).mapOr(0, twice) == 0, "Expected mapOr to return the default");
+        static_assert(
+            divideConstexpr(8, 0).mapOrElse([] { return 5; }, twice) == 5, "Expected mapOrElse to call the default function"
+        );
+        static_assert(
+            Result<ConstexprBox, int>(Ok(ConstexprBox(3))).map([](ConstexprBox box) { return box.value; }).unwrap() == 3,
+            "Expected map to move a non-trivial Ok value"
+        );
+    }
+
+    SECTION("Chain") {
+        constexpr auto halve = [](int value) {
+            return divideConstexpr(value, 2);
+        };
+        constexpr auto recover = [](int) -> Result<int, int> {
+            return Ok(0);
+        };
+        static_assert(divideConstexpr(8, 1).andThen(halve).andThen(halve).unwrap() == 2, "Expected andThen to chain");
+        static_assert(divideConstexpr(8, 0).andThen(halve).unwrapErr() == -1, "Expected andThen to stop at Err");
+        static_assert(divideConstexpr(8, 0).orElse(recover).unwrap() == 0, "Expected orElse to recover");
+        static_assert(divideConstexpr(8, 2).and_(divideConstexpr(9, 3)).unwrap() == 3, "Expected and_ to return the other Result");
+        static_assert(divideConstexpr(8, 0).or_(divideConstexpr(9, 3)).unwrap() == 3, "Expected or_ to return the other Result");
+        static_assert(divideConstexpr(8, 2).isOkAnd([](int value) { return value == 4; }), "Expected isOkAnd to be true");
+        static_assert(divideConstexpr(8, 0).isErrAnd([](int err) { return err == -1; }), "Expected isErrAnd to be true");
+    }
+
+    SECTION("Comparisons") {
+        static_assert(divideConstexpr(8, 2) == divideConstexpr(4, 1), "Expected equal Ok Results to compare equal");
+        static_assert(divideConstexpr(8, 0) == divideConstexpr(4, 0), "Expected equal Err Results to compare equal");
+        static_assert(divideConstexpr(8, 2) != divideConstexpr(8, 0), "Expected Ok and Err to compare unequal");
+        static_assert(divideConstexpr(8, 2) == Ok(4), "Expected Result to compare equal to Ok");
+        static_assert(divideConstexpr(8, 0) == Err(-1), "Expected Result to compare equal to Err");
+        static_assert(divideConstexpr(8, 2) != Err(4), "Expected Ok Result to compare unequal to Err");
+    }
+}
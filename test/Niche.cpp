@@ -0,0 +1,106 @@
+#include <Geode/Result.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+using namespace geode;
+
+enum class ParseError {
+    None,
+    Empty,
+    Invalid,
+};
+
+template <>
+struct geode::ResultNiche<ParseError> : ResultNicheValue<ParseError::None> {};
+
+struct Handle {
+    int id;
+};
+
+template <>
+struct geode::ResultNiche<Handle*> : ResultNicheValue<static_cast<Handle*>(nullptr)> {};
+
+static_assert(sizeof(Result<int&, void>) == sizeof(int*), "Expected the reference to hold the state");
+static_assert(sizeof(Result<Handle const&, void>) == sizeof(Handle*), "Expected the reference to hold the state");
+static_assert(sizeof(Result<void, int&>) == sizeof(int*), "Expected the reference to hold the state");
+static_assert(sizeof(Result<void, ParseError>) == sizeof(ParseError), "Expected the enum to hold the state");
+static_assert(sizeof(Result<Handle*, void>) == sizeof(Handle*), "Expected the pointer to hold the state");
+static_assert(sizeof(Result<void, void>) == 1, "Expected only the state to be stored");
+static_assert(sizeof(Result<int*, void>) > sizeof(int*), "Expected pointers without a niche to keep a flag");
+static_assert(std::is_trivially_copyable_v<Result<int&, void>>, "Expected Result<int&, void> to be trivially copyable");
+
+Result<Handle&, void> findHandle(int id) {
+    static Handle handles[] = {{0}, {1}, {2}};
+    if (id < 0 || id > 2) {
+        return Err();
+    }
+    return Ok(handles[id]);
+}
+
+Result<void, ParseError> parse(char const* str) {
+    if (!str) {
+        return Err(ParseError::Invalid);
+    }
+    if (!*str) {
+        return Err(ParseError::Empty);
+    }
+    return Ok();
+}
+
+constexpr Result<void, ParseError> parseConstexpr(int value) {
+    if (value < 0) {
+        return Err(ParseError::Invalid);
+    }
+    return Ok();
+}
+
+TEST_CASE("Niche") {
+    SECTION("Reference") {
+        auto res = findHandle(1);
+        REQUIRE(res.isOk());
+        REQUIRE(res.unwrap().id == 1);
+        REQUIRE(&res.unwrap() == &findHandle(1).unwrap());
+
+        auto res2 = findHandle(3);
+        REQUIRE(res2.isErr());
+        REQUIRE_THROWS_AS(res2.unwrap(), UnwrapException);
+
+        res2 = findHandle(2);
+        REQUIRE(res2.isOk());
+        REQUIRE(res2.unwrap().id == 2);
+    }
+
+    SECTION("Enum") {
+        auto res = parse("abc");
+        REQUIRE(res.isOk());
+
+        auto res2 = parse("");
+        REQUIRE(res2.isErr());
+        REQUIRE(res2.unwrapErr() == ParseError::Empty);
+        REQUIRE(res2 == Err(ParseError::Empty));
+
+        static_assert(parseConstexpr(1).isOk(), "Expected Ok result");
+        static_assert(parseConstexpr(-1).unwrapErr() == ParseError::Invalid, "Expected Invalid error");
+    }
+
+    SECTION("Pointer") {
+        Handle handle{5};
+        Result<Handle*, void> res = Ok(&handle);
+        REQUIRE(res.isOk());
+        REQUIRE(res.unwrap()->id == 5);
+
+        Result<Handle*, void> res2 = Err();
+        REQUIRE(res2.isErr());
+        REQUIRE(res2.unwrapOr(&handle) == &handle);
+    }
+
+    SECTION("Void") {
+        Result<void, void> res = Ok();
+        REQUIRE(res.isOk());
+
+        Result<void, void> res2 = Err();
+        REQUIRE(res2.isErr());
+        REQUIRE(res != res2);
+    }
+}
@@ -270,6 +270,22 @@ TEST_CASE("Normal") {
         REQUIRE(res4.unwrapErr() == "Division by zero");
     }
 
+    SECTION("assignment") {
+        auto res = divide(32, 2);
+        res = divide(32, 0);
+        REQUIRE(res.isErr());
+        REQUIRE(res.unwrapErr() == "Division by zero");
+
+        res = divide(32, 4);
+        REQUIRE(res.isOk());
+        REQUIRE(res.unwrap() == 8);
+
+        auto res2 = divide(1, 0);
+        auto res3 = divide(2, 0);
+        res2 = std::move(res3);
+        REQUIRE(res2.unwrapErr() == "Division by zero");
+    }
+
     SECTION("equality") {
         Result<float, std::string> res1 = Ok(32.f);
         Result<float, std::string> res2 = Ok(16.f);
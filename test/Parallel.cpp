@@ -0,0 +1,137 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Parallel.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+
+using namespace geode;
+
+Result<int, std::string> parallelValidate(int value) {
+    if (value < 0) {
+        return Err("Negative value at " + std::to_string(-value));
+    }
+    return Ok(value * 2);
+}
+
+TEST_CASE("Parallel") {
+    std::vector<int> values(10000);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto threads = GENERATE(1, 4, 16);
+    parallel::Options options{.threads = static_cast<std::size_t>(threads), .chunkSize = 64};
+
+    SECTION("tryTransform") {
+        SECTION("Ok") {
+            auto res = parallel::tryTransform(values, parallelValidate, options);
+            REQUIRE(res.isOk());
+            std::vector<int> expected;
+            for (auto value : values) {
+                expected.push_back(value * 2);
+            }
+            REQUIRE(res.unwrap() == expected);
+        }
+
+        SECTION("First Err") {
+            values[7000] = -7000;
+            values[3000] = -3000;
+            values[9000] = -9000;
+            auto res = parallel::tryTransform(values, parallelValidate, options);
+            REQUIRE(res.isErr());
+            REQUIRE(res.unwrapErr() == "Negative value at 3000");
+        }
+
+        SECTION("Stops Early") {
+            values[0] = -1;
+            std::atomic<std::size_t> calls = 0;
+            auto res = parallel::tryTransform(values, [&](int value) {
+                calls += 1;
+                return parallelValidate(value);
+            }, options);
+            REQUIRE(res.unwrapErr() == "Negative value at 1");
+            REQUIRE(calls < values.size());
+        }
+
+        SECTION("Empty") {
+            auto res = parallel::tryTransform(std::vector<int>(), parallelValidate, options);
+            REQUIRE(res.unwrap().empty());
+        }
+
+        SECTION("Non Default Constructible") {
+            auto res = parallel::tryTransform(values, [](int value) -> Result<std::unique_ptr<int>, std::string> {
+                return Ok(std::make_unique<int>(value));
+            }, options);
+            REQUIRE(*res.unwrap()[1234] == 1234);
+        }
+
+        SECTION("Bool") {
+            auto res = parallel::tryTransform(values, [](int value) -> Result<bool, std::string> {
+                return Ok(value % 2 == 0);
+            }, options);
+            auto even = std::move(res).unwrap();
+            REQUIRE(even[10]);
+            REQUIRE(!even[11]);
+        }
+
+        SECTION("Reference Err") {
+            values[6000] = -1;
+            values[2000] = -1;
+            auto res = parallel::tryTransform(values, [&](int& value) -> Result<int, int&> {
+                if (value < 0) {
+                    return Err(value);
+                }
+                return Ok(value);
+            }, options);
+            static_assert(std::is_same_v<decltype(res), Result<std::vector<int>, int&>>);
+            REQUIRE(&res.unwrapErr() == &values[2000]);
+        }
+
+        SECTION("Exceptions") {
+            auto throwing = [](int value) -> Result<int, std::string> {
+                if (value == 5000) {
+                    throw std::runtime_error("5000");
+                }
+                return Ok(value);
+            };
+            REQUIRE_THROWS_AS(parallel::tryTransform(values, throwing, options), std::runtime_error);
+        }
+    }
+
+    SECTION("tryForEach") {
+        std::vector<std::atomic<int>> seen(values.size());
+        auto visit = [&](int value) -> Result<void, std::string> {
+            if (value < 0) {
+                return Err("Negative");
+            }
+            seen[value] += 1;
+            return Ok();
+        };
+
+        SECTION("Ok") {
+            REQUIRE(parallel::tryForEach(values, visit, options).isOk());
+            REQUIRE(std::all_of(seen.begin(), seen.end(), [](auto& count) { return count == 1; }));
+        }
+
+        SECTION("Err") {
+            values[500] = -1;
+            REQUIRE(parallel::tryForEach(values, visit, options).unwrapErr() == "Negative");
+            REQUIRE(std::all_of(seen.begin(), seen.begin() + 500, [](auto& count) { return count == 1; }));
+        }
+
+        SECTION("Reference Err") {
+            values[800] = -1;
+            auto res = parallel::tryForEach(values, [](int& value) -> Result<void, int&> {
+                if (value < 0) {
+                    return Err(value);
+                }
+                return Ok();
+            }, options);
+            REQUIRE(&res.unwrapErr() == &values[800]);
+        }
+    }
+}
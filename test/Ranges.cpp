@@ -0,0 +1,205 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Ranges.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <deque>
+#include <list>
+#include <memory>
+#include <set>
+
+using namespace geode;
+
+Result<int, std::string> rangesParseDigit(char c) {
+    if (c < '0' || c > '9') {
+        return Err(std::string("Not a digit: ") + c);
+    }
+    return Ok(c - '0');
+}
+
+std::vector<Result<int, std::string>> rangesParseAll(std::string_view str) {
+    std::vector<Result<int, std::string>> results;
+    for (auto c : str) {
+        results.push_back(rangesParseDigit(c));
+    }
+    return results;
+}
+
+TEST_CASE("Ranges") {
+    SECTION("collect") {
+        SECTION("Ok") {
+            auto res = collect(rangesParseAll("1234"));
+            REQUIRE(res.isOk());
+            REQUIRE(res.unwrap() == std::vector<int>{1, 2, 3, 4});
+        }
+
+        SECTION("Err") {
+            auto res = collect(rangesParseAll("12a4b"));
+            REQUIRE(res.isErr());
+            REQUIRE(res.unwrapErr() == "Not a digit: a");
+        }
+
+        SECTION("Empty") {
+            auto res = collect(std::vector<Result<int, std::string>>());
+            REQUIRE(res.isOk());
+            REQUIRE(res.unwrap().empty());
+        }
+
+        SECTION("Containers") {
+            REQUIRE(collect<std::deque>(rangesParseAll("12")).unwrap() == std::deque<int>{1, 2});
+            REQUIRE(collect<std::set<int>>(rangesParseAll("2112")).unwrap() == std::set<int>{1, 2});
+            REQUIRE(collect<std::list<long>>(rangesParseAll("3")).unwrap() == std::list<long>{3});
+        }
+
+        SECTION("Reserve") {
+            auto res = collect(rangesParseAll("123456789"));
+            REQUIRE(res.unwrap().capacity() == 9);
+        }
+
+        SECTION("Views") {
+            std::string_view digits = "4321";
+            auto res = collect(digits | std::views::transform(rangesParseDigit));
+            REQUIRE(res.unwrap() == std::vector<int>{4, 3, 2, 1});
+        }
+
+        SECTION("Move") {
+            std::vector<Result<std::unique_ptr<int>, std::string>> results;
+            results.push_back(Ok(std::make_unique<int>(1)));
+            results.push_back(Ok(std::make_unique<int>(2)));
+            auto res = collect(std::move(results));
+            REQUIRE(res.isOk());
+            REQUIRE(*res.unwrap()[1] == 2);
+        }
+
+        SECTION("Void Err") {
+            std::vector<Result<int, void>> results{Ok(1), Err(), Ok(2)};
+            REQUIRE(collect(results).isErr());
+        }
+
+        SECTION("Lvalues are copied") {
+            std::vector<Result<std::string, std::string>> results;
+            results.push_back(Ok(std::string("a long string that is heap allocated")));
+            auto res = collect(results);
+            REQUIRE(res.unwrap()[0] == "a long string that is heap allocated");
+            REQUIRE(results[0].unwrap() == "a long string that is heap allocated");
+        }
+
+        SECTION("Views over lvalues are copied") {
+            std::vector<Result<std::string, std::string>> results;
+            results.push_back(Ok(std::string("a long string that is heap allocated")));
+            results.push_back(Ok(std::string("another long string that is heap allocated")));
+            auto taken = collect(results | std::views::take(1));
+            REQUIRE(taken.unwrap() == std::vector<std::string>{"a long string that is heap allocated"});
+            auto all = collect(std::views::all(results));
+            REQUIRE(all.unwrap().size() == 2);
+            auto allErrs = collectAll(std::views::all(results));
+            REQUIRE(allErrs.unwrap().size() == 2);
+            REQUIRE(results[0].unwrap() == "a long string that is heap allocated");
+            REQUIRE(results[1].unwrap() == "another long string that is heap allocated");
+        }
+
+        SECTION("Owning Views are moved") {
+            std::vector<Result<std::string, std::string>> results;
+            results.push_back(Ok(std::string("a long string that is heap allocated")));
+            auto res = collect(std::views::all(std::move(results)));
+            REQUIRE(res.unwrap()[0] == "a long string that is heap allocated");
+            static_assert(impl::MovesElements<std::ranges::owning_view<std::vector<Result<std::string, std::string>>>>);
+            static_assert(!impl::MovesElements<std::ranges::ref_view<std::vector<Result<std::string, std::string>>>>);
+            static_assert(impl::MovesElements<std::vector<Result<std::string, std::string>>>);
+            static_assert(!impl::MovesElements<std::vector<Result<std::string, std::string>>&>);
+        }
+    }
+
+    SECTION("collectAll") {
+        SECTION("Ok") {
+            auto res = collectAll(rangesParseAll("1234"));
+            REQUIRE(res.unwrap() == std::vector<int>{1, 2, 3, 4});
+        }
+
+        SECTION("Err") {
+            auto res = collectAll(rangesParseAll("1a2b"));
+            REQUIRE(res.isErr());
+            REQUIRE(res.unwrapErr() == std::vector<std::string>{"Not a digit: a", "Not a digit: b"});
+        }
+
+        SECTION("Containers") {
+            auto res = collectAll<std::set<int>, std::deque<std::string>>(rangesParseAll("x"));
+            REQUIRE(res.unwrapErr() == std::deque<std::string>{"Not a digit: x"});
+        }
+    }
+
+    SECTION("views") {
+        auto results = rangesParseAll("1a2b3");
+
+        SECTION("oks") {
+            std::vector<int> values;
+            for (int& value : results | views::oks) {
+                values.push_back(value);
+            }
+            REQUIRE(values == std::vector<int>{1, 2, 3});
+            REQUIRE(&*(results | views::oks).begin() == &results[0].unwrap());
+            static_assert(std::ranges::forward_range<decltype(results | views::oks)>);
+
+            auto const& constResults = results;
+            auto firstTwo = constResults | views::oks | std::views::take(2);
+            REQUIRE(std::ranges::distance(firstTwo) == 2);
+        }
+
+        SECTION("errs") {
+            std::vector<std::string> errors;
+            for (auto const& error : results | views::errs) {
+                errors.push_back(error);
+            }
+            REQUIRE(errors == std::vector<std::string>{"Not a digit: a", "Not a digit: b"});
+        }
+
+        SECTION("takeWhileOk") {
+            std::vector<int> values;
+            for (int value : results | views::takeWhileOk) {
+                values.push_back(value);
+            }
+            REQUIRE(values == std::vector<int>{1});
+            REQUIRE(std::ranges::distance(rangesParseAll("123") | views::takeWhileOk) == 3);
+        }
+
+        SECTION("transformOk") {
+            auto doubled = results | views::transformOk([](int value) {
+                return value * 2;
+            });
+            std::vector<int> values;
+            for (int value : doubled | views::oks) {
+                values.push_back(value);
+            }
+            REQUIRE(values == std::vector<int>{2, 4, 6});
+        }
+
+        SECTION("Composition") {
+            int parsed = 0;
+            std::string_view digits = "9x87y6";
+            auto view = digits | std::views::transform([&](char c) {
+                parsed += 1;
+                return rangesParseDigit(c);
+            }) | views::oks | std::views::transform([](int value) {
+                return value + 1;
+            });
+            std::vector<int> values;
+            for (int value : view) {
+                values.push_back(value);
+            }
+            REQUIRE(values == std::vector<int>{10, 9, 8, 7});
+            // every element is only parsed once
+            REQUIRE(parsed == 6);
+            static_assert(!std::ranges::forward_range<decltype(view)>);
+        }
+
+        SECTION("Move Only") {
+            std::vector<Result<std::unique_ptr<int>, std::string>> pointers;
+            pointers.push_back(Ok(std::make_unique<int>(5)));
+            pointers.push_back(Err("Error"));
+            auto values = pointers | views::oks;
+            auto pointer = std::move(*values.begin());
+            REQUIRE(*pointer == 5);
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Slot.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <memory>
+#include <thread>
+
+using namespace geode;
+
+struct SlotCounter {
+    int* count;
+
+    SlotCounter(int* count) : count(count) {}
+
+    SlotCounter(SlotCounter&& other) noexcept : count(std::exchange(other.count, nullptr)) {}
+
+    ~SlotCounter() {
+        if (count) {
+            *count += 1;
+        }
+    }
+};
+
+TEST_CASE("Slot") {
+    SECTION("Ok") {
+        ResultSlot<std::string, int> slot;
+        REQUIRE(!slot.ready());
+        slot.emplaceOk(5, 'a');
+        REQUIRE(slot.ready());
+        auto res = slot.get();
+        REQUIRE(res.unwrap() == "aaaaa");
+        REQUIRE(!slot.ready());
+    }
+
+    SECTION("Err") {
+        ResultSlot<int, std::string> slot;
+        slot.emplaceErr("Error");
+        REQUIRE(slot.get().unwrapErr() == "Error");
+    }
+
+    SECTION("Set") {
+        ResultSlot<int, std::string> slot;
+        slot.set(Ok(3));
+        REQUIRE(slot.get().unwrap() == 3);
+        slot.set(Err("Error"));
+        REQUIRE(slot.get().unwrapErr() == "Error");
+    }
+
+    SECTION("Void") {
+        ResultSlot<void, std::string> slot;
+        slot.emplaceOk();
+        REQUIRE(slot.get().isOk());
+        slot.set(Err("Error"));
+        REQUIRE(slot.get().unwrapErr() == "Error");
+
+        ResultSlot<int, void> voidErr;
+        voidErr.emplaceErr();
+        REQUIRE(voidErr.get().isErr());
+    }
+
+    SECTION("Reference") {
+        int value = 1;
+        ResultSlot<int&, std::string> slot;
+        slot.emplaceOk(value);
+        auto res = slot.get();
+        res.unwrap() = 2;
+        REQUIRE(value == 2);
+    }
+
+    SECTION("Move Only") {
+        ResultSlot<std::unique_ptr<int>, std::string> slot;
+        slot.emplaceOk(std::make_unique<int>(4));
+        REQUIRE(*slot.get().unwrap() == 4);
+    }
+
+    SECTION("tryGet") {
+        ResultSlot<int, std::string> slot;
+        REQUIRE(!slot.tryGet());
+        slot.emplaceOk(1);
+        auto res = slot.tryGet();
+        REQUIRE(res);
+        REQUIRE(res->unwrap() == 1);
+        REQUIRE(!slot.tryGet());
+    }
+
+    SECTION("Destroys Values") {
+        int count = 0;
+        {
+            ResultSlot<SlotCounter, std::string> slot;
+            slot.emplaceOk(&count);
+            (void)slot.get();
+            REQUIRE(count == 1);
+            slot.emplaceOk(&count);
+        }
+        REQUIRE(count == 2);
+    }
+
+    SECTION("Threads") {
+        constexpr int Count = 10000;
+        ResultSlot<std::string, int> slot;
+        std::jthread producer([&] {
+            for (int i = 0; i < Count; ++i) {
+                if (i % 3 == 0) {
+                    slot.emplaceErr(i);
+                }
+                else {
+                    slot.emplaceOk(std::to_string(i));
+                }
+            }
+        });
+
+        bool ordered = true;
+        for (int i = 0; i < Count; ++i) {
+            auto res = slot.get();
+            if (i % 3 == 0) {
+                ordered = ordered && res.isErr() && res.unwrapErr() == i;
+            }
+            else {
+                ordered = ordered && res.isOk() && res.unwrap() == std::to_string(i);
+            }
+        }
+        REQUIRE(ordered);
+    }
+
+    SECTION("Wait") {
+        ResultSlot<int, std::string> slot;
+        std::jthread producer([&] {
+            slot.emplaceOk(7);
+        });
+        slot.wait();
+        REQUIRE(slot.ready());
+        REQUIRE(slot.get().unwrap() == 7);
+    }
+}
@@ -0,0 +1,129 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Sys.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <sstream>
+
+using namespace geode;
+
+static_assert(sizeof(Errno) == sizeof(int));
+static_assert(sizeof(Result<void, Errno>) == sizeof(int));
+static_assert(std::is_trivially_copyable_v<Result<std::size_t, Errno>>);
+
+TEST_CASE("Errno") {
+    SECTION("Message") {
+        Errno error(ENOENT);
+        REQUIRE(error == ENOENT);
+        REQUIRE(error.code() == ENOENT);
+        REQUIRE(error.message() == std::strerror(ENOENT));
+        char buffer[Errno::MessageSize];
+        REQUIRE(error.message(buffer, sizeof(buffer)) == std::strerror(ENOENT));
+        std::ostringstream stream;
+        stream << error;
+        REQUIRE(stream.str() == std::strerror(ENOENT));
+    }
+
+    SECTION("Would Block") {
+        REQUIRE(Errno(EAGAIN).wouldBlock());
+        REQUIRE(Errno(EWOULDBLOCK).wouldBlock());
+        REQUIRE(!Errno(EINVAL).wouldBlock());
+    }
+
+    SECTION("Niche") {
+        Result<void, Errno> ok = Ok();
+        REQUIRE(ok.isOk());
+        Result<void, Errno> err = Err(Errno(EBADF));
+        REQUIRE(err.unwrapErr() == EBADF);
+        // errno can be 0 when a call fails without setting it, which must stay an Err
+        Result<void, Errno> zero = Err(Errno());
+        REQUIRE(zero.isErr());
+        REQUIRE(zero.unwrapErr() == 0);
+        errno = 0;
+        Result<void, Errno> last = Err(Errno::last());
+        REQUIRE(last.isErr());
+        Result<void, Errno> reserved = Err(Errno(INT_MIN));
+        REQUIRE(reserved.isErr());
+    }
+
+    SECTION("Unwrap") {
+        Result<int, Errno> res = Err(Errno(ENOENT));
+        try {
+            (void)res.unwrap();
+            FAIL("Expected UnwrapException to be thrown");
+        }
+        catch (UnwrapException const& e) {
+            REQUIRE(e.what() == std::string("Called unwrap on an Err Result: ") + std::strerror(ENOENT));
+        }
+    }
+}
+
+#if defined(GEODE_RESULT_IMPL_POSIX)
+Result<std::string, Errno> sysReadAll(char const* path) {
+    GEODE_UNWRAP_INTO(int fd, sys::open(path, O_RDONLY));
+    auto status = sys::fstat(fd);
+    std::string contents(status.isOk() ? status.unwrap().st_size : 0, '\0');
+    auto count = sys::pread(fd, contents.data(), contents.size(), 0);
+    (void)sys::close(fd);
+    GEODE_UNWRAP_INTO(std::size_t size, std::move(count));
+    contents.resize(size);
+    return Ok(std::move(contents));
+}
+
+TEST_CASE("Sys") {
+    SECTION("Missing File") {
+        auto res = sysReadAll("/nonexistent/geode/result");
+        REQUIRE(res.unwrapErr() == ENOENT);
+    }
+
+    SECTION("Read And Write") {
+        char path[] = "/tmp/geode-result-sys-XXXXXX";
+        int fd = ::mkstemp(path);
+        REQUIRE(fd != -1);
+        REQUIRE(sys::write(fd, "hello world", 11).unwrap() == 11);
+        REQUIRE(sys::pwrite(fd, "W", 1, 6).unwrap() == 1);
+        REQUIRE(sys::lseek(fd, 0, SEEK_SET).unwrap() == 0);
+        char buffer[16] = {};
+        REQUIRE(sys::read(fd, buffer, sizeof(buffer)).unwrap() == 11);
+        REQUIRE(std::string_view(buffer, 11) == "hello World");
+        REQUIRE(sys::fsync(fd).isOk());
+        REQUIRE(sys::ftruncate(fd, 5).isOk());
+        REQUIRE(sys::stat(path).unwrap().st_size == 5);
+        REQUIRE(sys::close(fd).isOk());
+        REQUIRE(sysReadAll(path).unwrap() == "hello");
+        REQUIRE(sys::close(fd).unwrapErr() == EBADF);
+        ::unlink(path);
+    }
+
+    SECTION("Map") {
+        auto mapping = sys::mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        REQUIRE(mapping.isOk());
+        static_cast<char*>(mapping.unwrap())[0] = 'x';
+        REQUIRE(sys::munmap(mapping.unwrap(), 4096).isOk());
+        REQUIRE(sys::mmap(nullptr, 0, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0).unwrapErr() == EINVAL);
+    }
+
+    SECTION("Non Blocking") {
+        int fds[2];
+        REQUIRE(::pipe(fds) == 0);
+        REQUIRE(::fcntl(fds[0], F_SETFL, O_NONBLOCK) == 0);
+        char buffer[8];
+        auto res = sys::read(fds[0], buffer, sizeof(buffer));
+        REQUIRE(res.unwrapErr().wouldBlock());
+        REQUIRE(sys::write(fds[1], "ping", 4).unwrap() == 4);
+        std::size_t count = 0;
+        while (true) {
+            auto next = sys::read(fds[0], buffer, sizeof(buffer));
+            if (next.isOk()) {
+                count = next.unwrap();
+                break;
+            }
+            REQUIRE(next.unwrapErr().wouldBlock());
+        }
+        REQUIRE(std::string_view(buffer, count) == "ping");
+        (void)sys::close(fds[0]);
+        (void)sys::close(fds[1]);
+    }
+}
+#endif
@@ -0,0 +1,232 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Tasks.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+
+using namespace geode;
+
+Result<int, std::string> taskHalve(int value) {
+    if (value % 2 != 0) {
+        return Err("Odd value " + std::to_string(value));
+    }
+    return Ok(value / 2);
+}
+
+// Hands the first tasks to a pool, then fails to submit any more
+struct FailingExecutor {
+    ThreadPool& pool;
+    int accepted;
+
+    void execute(ExecutorTask& task) {
+        if (accepted-- == 0) {
+            throw std::runtime_error("Queue is full");
+        }
+        pool.execute(task);
+    }
+};
+
+TEST_CASE("Tasks") {
+    ThreadPool pool(4);
+
+    SECTION("whenAll") {
+        SECTION("Ok") {
+            auto res = whenAll(
+                pool,
+                [] { return taskHalve(4); },
+                []() -> Result<std::string, std::string> { return Ok("text"); },
+                []() -> Result<void, std::string> { return Ok(); }
+            );
+            REQUIRE(res.isOk());
+            auto [first, second, third] = res.unwrap();
+            REQUIRE(first == 2);
+            REQUIRE(second == "text");
+            REQUIRE(third == std::monostate());
+        }
+
+        SECTION("Err") {
+            auto res = whenAll(
+                pool,
+                [] { return taskHalve(4); },
+                [] { return taskHalve(3); }
+            );
+            REQUIRE(res.unwrapErr() == "Odd value 3");
+        }
+
+        SECTION("Inline") {
+            InlineExecutor executor;
+            int ran = 0;
+            auto res = whenAll(
+                executor,
+                [&] { ++ran; return taskHalve(4); },
+                [&] { ++ran; return taskHalve(5); },
+                [&] { ++ran; return taskHalve(6); }
+            );
+            REQUIRE(res.unwrapErr() == "Odd value 5");
+            // the task after the first Err never starts
+            REQUIRE(ran == 2);
+        }
+
+        SECTION("Shared Pool") {
+            auto res = whenAll([] { return taskHalve(8); }, [] { return taskHalve(10); });
+            REQUIRE(res.unwrap() == std::tuple(4, 5));
+        }
+
+        SECTION("Vector") {
+            std::vector<std::function<Result<int, std::string>()>> tasks;
+            for (int i = 0; i < 100; ++i) {
+                tasks.push_back([i] { return taskHalve(i * 2); });
+            }
+            auto res = whenAll(pool, tasks);
+            std::vector<int> expected;
+            for (int i = 0; i < 100; ++i) {
+                expected.push_back(i);
+            }
+            REQUIRE(res.unwrap() == expected);
+
+            tasks[40] = [] { return taskHalve(41); };
+            REQUIRE(whenAll(pool, tasks).unwrapErr() == "Odd value 41");
+        }
+
+        SECTION("Empty") {
+            std::vector<Result<int, std::string> (*)()> tasks;
+            REQUIRE(whenAll(pool, tasks).unwrap().empty());
+        }
+
+        SECTION("Void Vector") {
+            std::atomic<int> count = 0;
+            auto task = [&]() -> Result<void, std::string> {
+                ++count;
+                return Ok();
+            };
+            std::vector tasks(50, task);
+            REQUIRE(whenAll(pool, tasks).isOk());
+            REQUIRE(count == 50);
+        }
+
+        SECTION("Transform View") {
+            // every task is a temporary, destroyed before a worker could run it
+            // unless the nodes own them
+            auto tasks = std::views::iota(0, 50) | std::views::transform([](int i) {
+                return [i, text = std::string(32, 'x')] {
+                    return taskHalve(i * 2 + static_cast<int>(text.size()) - 32);
+                };
+            });
+            auto values = whenAll(pool, tasks).unwrap();
+            REQUIRE(values.size() == 50);
+            REQUIRE(values[49] == 49);
+        }
+
+        SECTION("Submission Failure") {
+            std::atomic<int> ran = 0;
+            std::vector<std::function<Result<int, std::string>()>> tasks(8, [&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                ++ran;
+                return taskHalve(2);
+            });
+            FailingExecutor executor{pool, 3};
+            REQUIRE_THROWS_AS(whenAll(executor, tasks), std::runtime_error);
+            // the submitted tasks finish before the exception leaves whenAll
+            REQUIRE(ran <= 3);
+            auto finished = ran.load();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            REQUIRE(ran == finished);
+
+            executor.accepted = 1;
+            REQUIRE_THROWS_AS(
+                whenAll(executor, [&] { return taskHalve(2); }, [&] { return taskHalve(4); }),
+                std::runtime_error
+            );
+        }
+
+        SECTION("Cancellation") {
+            auto res = whenAll(
+                pool,
+                [](std::stop_token stop) -> Result<int, std::string> {
+                    while (!stop.stop_requested()) {
+                        std::this_thread::yield();
+                    }
+                    return Err("Cancelled");
+                },
+                [] { return taskHalve(7); }
+            );
+            REQUIRE(res.unwrapErr() == "Odd value 7");
+        }
+
+        SECTION("Exception") {
+            REQUIRE_THROWS_AS(
+                whenAll(
+                    pool,
+                    [] { return taskHalve(2); },
+                    []() -> Result<int, std::string> { throw std::runtime_error("failed"); }
+                ),
+                std::runtime_error
+            );
+        }
+
+        SECTION("Nested") {
+            auto res = whenAll(
+                pool,
+                [&] {
+                    return whenAll(pool, [] { return taskHalve(2); }, [] { return taskHalve(4); })
+                        .map([](auto values) { return std::get<0>(values) + std::get<1>(values); });
+                },
+                [&] { return taskHalve(6); }
+            );
+            REQUIRE(res.unwrap() == std::tuple(3, 3));
+        }
+    }
+
+    SECTION("whenAny") {
+        SECTION("Ok") {
+            auto res = whenAny(
+                pool,
+                [] { return taskHalve(3); },
+                [] { return taskHalve(4); },
+                [] { return taskHalve(5); }
+            );
+            REQUIRE(res.unwrap() == 2);
+        }
+
+        SECTION("All Err") {
+            auto res = whenAny(
+                pool,
+                [] { return taskHalve(1); },
+                [] { return taskHalve(3); }
+            );
+            REQUIRE(res.unwrapErr() == std::vector<std::string>{"Odd value 1", "Odd value 3"});
+        }
+
+        SECTION("Inline") {
+            InlineExecutor executor;
+            int ran = 0;
+            auto res = whenAny(
+                executor,
+                [&] { ++ran; return taskHalve(3); },
+                [&] { ++ran; return taskHalve(4); },
+                [&] { ++ran; return taskHalve(6); }
+            );
+            REQUIRE(res.unwrap() == 2);
+            REQUIRE(ran == 2);
+        }
+
+        SECTION("Vector") {
+            std::vector<std::function<Result<int, std::string>()>> tasks;
+            for (int i = 0; i < 20; ++i) {
+                tasks.push_back([i] { return taskHalve(i * 2 + 1); });
+            }
+            auto errs = whenAny(pool, tasks).unwrapErr();
+            REQUIRE(errs.size() == 20);
+            REQUIRE(errs[19] == "Odd value 39");
+
+            tasks[10] = [] { return taskHalve(10); };
+            REQUIRE(whenAny(pool, tasks).unwrap() == 5);
+        }
+    }
+}
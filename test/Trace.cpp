@@ -0,0 +1,162 @@
+// Built into the instrumented executable with GEODE_RESULT_TRACING defined,
+// since the hook has to be enabled for the whole program
+#include <Geode/Result.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace geode;
+
+enum class TraceCode : int {
+    NotFound = 404,
+};
+
+static constexpr std::uint32_t traceErrLine = __LINE__ + 3;
+Result<int, std::string> traceParse(std::string_view str) {
+    if (str.empty()) {
+        return Err("empty \"input\"");
+    }
+    return Ok(static_cast<int>(str.size()));
+}
+
+Result<int, std::string> traceLoad(std::string_view str) {
+    GEODE_UNWRAP_INTO(int value, traceParse(str));
+    return Ok(value);
+}
+
+Result<int, TraceCode> traceFind() {
+    return Err(TraceCode::NotFound);
+}
+
+Result<int, ContextError> traceContext() {
+    return Err(ContextError(Error("root cause")).context("outer"));
+}
+
+// Traces an Err from its destructor, which runs after the RingOwner of its
+// thread has been destroyed if it was constructed before it
+struct TraceOnExit {
+    ~TraceOnExit() {
+        (void)traceParse("");
+    }
+};
+
+std::vector<tracing::ErrEvent> drainAll() {
+    std::vector<tracing::ErrEvent> events;
+    tracing::drain([&](tracing::ErrEvent const& event) {
+        events.push_back(event);
+    });
+    return events;
+}
+
+TEST_CASE("Trace") {
+    (void)drainAll();
+    tracing::setSampleRate(1);
+
+    SECTION("Event") {
+        (void)traceParse("");
+        auto events = drainAll();
+        REQUIRE(events.size() == 1);
+        auto& event = events[0];
+        REQUIRE(std::string_view(event.file).ends_with("Trace.cpp"));
+        REQUIRE(event.line == traceErrLine);
+        REQUIRE(std::string_view(event.function).find("traceParse") != std::string_view::npos);
+        REQUIRE(event.type.find("string") != std::string_view::npos);
+        REQUIRE(event.message() == "empty \"input\"");
+        REQUIRE(event.timestamp > 0);
+        REQUIRE(drainAll().empty());
+    }
+
+    SECTION("Messages") {
+        (void)traceFind();
+        (void)traceContext();
+        Result<int, std::string> longErr = Err(std::string(100, 'x'));
+        auto events = drainAll();
+        REQUIRE(events.size() == 3);
+        REQUIRE(events[0].type.find("TraceCode") != std::string_view::npos);
+        REQUIRE(events[0].message() == "404");
+        REQUIRE(events[1].message() == "root cause");
+        REQUIRE(events[2].message() == std::string(sizeof(events[2].messageData), 'x'));
+    }
+
+    SECTION("Propagation") {
+        auto res = traceLoad("");
+        (void)res.mapErr([](std::string const& err) { return err.size(); });
+        REQUIRE(drainAll().size() == 1);
+    }
+
+    SECTION("Sampling") {
+        tracing::setSampleRate(10);
+        for (int i = 0; i < 101; ++i) {
+            (void)traceParse("");
+        }
+        REQUIRE(drainAll().size() == 11);
+        tracing::setSampleRate(0);
+        for (int i = 0; i < 100; ++i) {
+            (void)traceParse("");
+        }
+        REQUIRE(drainAll().empty());
+    }
+
+    SECTION("Full") {
+        auto dropped = tracing::dropped();
+        for (int i = 0; i < GEODE_RESULT_TRACE_CAPACITY + 10; ++i) {
+            (void)traceParse("");
+        }
+        REQUIRE(tracing::dropped() == dropped + 10);
+        REQUIRE(drainAll().size() == GEODE_RESULT_TRACE_CAPACITY);
+    }
+
+    SECTION("Threads") {
+        std::atomic<bool> done = false;
+        std::size_t drained = 0;
+        std::jthread reader([&] {
+            while (!done.load()) {
+                drained += tracing::drain([](tracing::ErrEvent const&) {});
+            }
+        });
+        auto dropped = tracing::dropped();
+        {
+            std::vector<std::jthread> writers;
+            for (int t = 0; t < 4; ++t) {
+                writers.emplace_back([] {
+                    for (int i = 0; i < 5000; ++i) {
+                        (void)traceParse("");
+                    }
+                });
+            }
+        }
+        done = true;
+        reader.join();
+        drained += drainAll().size();
+        REQUIRE(drained + (tracing::dropped() - dropped) == 20000);
+    }
+
+    SECTION("After Thread Exit") {
+        auto dropped = tracing::dropped();
+        std::thread([] {
+            thread_local TraceOnExit onExit;
+            (void)traceParse("");
+        }).join();
+        REQUIRE(drainAll().size() == 1);
+        REQUIRE(tracing::dropped() - dropped == 1);
+    }
+
+    SECTION("JSON Lines") {
+        (void)traceParse("");
+        (void)traceFind();
+        std::ostringstream stream;
+        REQUIRE(tracing::exportJsonLines(stream) == 2);
+        auto lines = stream.str();
+        auto first = lines.substr(0, lines.find('\n') + 1);
+        REQUIRE(first.starts_with("{\"timestamp\":"));
+        REQUIRE(first.find("\"line\":" + std::to_string(traceErrLine) + ",") != std::string::npos);
+        REQUIRE(first.find("\"message\":\"empty \\\"input\\\"\"}\n") != std::string::npos);
+        REQUIRE(std::count(lines.begin(), lines.end(), '\n') == 2);
+    }
+
+    tracing::setSampleRate(GEODE_RESULT_TRACE_SAMPLE_RATE);
+}
@@ -0,0 +1,273 @@
+#include <Geode/Result.hpp>
+#include <Geode/result/Validated.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include <string>
+#include <string_view>
+
+using namespace geode;
+
+struct Signup {
+    std::string name;
+    int age;
+};
+
+Validated<std::string> validateName(std::string_view name) {
+    if (name.empty()) {
+        return Err("name is empty");
+    }
+    return Ok(std::string(name));
+}
+
+Validated<int> validateAge(int age) {
+    if (age < 0) {
+        return Err("age is negative");
+    }
+    return Ok(age);
+}
+
+namespace {
+    int g_errorAllocations = 0;
+
+    template <class Type>
+    struct ErrorAllocator {
+        using value_type = Type;
+
+        ErrorAllocator() = default;
+
+        template <class Other>
+        ErrorAllocator(ErrorAllocator<Other> const&) {}
+
+        Type* allocate(std::size_t count) {
+            ++g_errorAllocations;
+            return std::allocator<Type>().allocate(count);
+        }
+
+        void deallocate(Type* ptr, std::size_t count) {
+            std::allocator<Type>().deallocate(ptr, count);
+        }
+
+        template <class Other>
+        bool operator==(ErrorAllocator<Other> const&) const {
+            return true;
+        }
+    };
+
+    using CountedString = std::basic_string<char, std::char_traits<char>, ErrorAllocator<char>>;
+}
+
+Validated<Signup> validateSignup(std::string_view name, int age, std::string_view password) {
+    return combine(
+        [](std::string name, int age) {
+            return Signup{std::move(name), age};
+        },
+        validateName(name),
+        validateAge(age),
+        check(password.size() >= 8, "password is too short")
+    );
+}
+
+TEST_CASE("SmallVector") {
+    SECTION("Inline") {
+        SmallVector<std::string, 2> vector;
+        REQUIRE(vector.empty());
+        REQUIRE(vector.capacity() == 2);
+        vector.pushBack("a");
+        vector.emplaceBack(3, 'b');
+        REQUIRE(vector.isInline());
+        REQUIRE(vector.size() == 2);
+        REQUIRE(vector[1] == "bbb");
+        vector.popBack();
+        REQUIRE(vector.size() == 1);
+        REQUIRE(vector.back() == "a");
+    }
+
+    SECTION("Spill") {
+        SmallVector<std::string, 2> vector = {"a", "b"};
+        // the new element is constructed before the old ones are moved
+        vector.pushBack(vector[0]);
+        REQUIRE(!vector.isInline());
+        REQUIRE(vector.capacity() >= 3);
+        for (int i = 0; i < 20; ++i) {
+            vector.emplaceBack();
+        }
+        REQUIRE(vector.size() == 23);
+        REQUIRE(vector[2] == "a");
+        REQUIRE(vector[22].empty());
+        vector.clear();
+        REQUIRE(vector.empty());
+        REQUIRE(!vector.isInline());
+    }
+
+    SECTION("Copy And Move") {
+        SmallVector<std::string, 2> small = {"a"};
+        SmallVector<std::string, 2> large = {"a", "b", "c"};
+
+        auto smallCopy = small;
+        auto largeCopy = large;
+        REQUIRE(smallCopy == small);
+        REQUIRE(largeCopy == large);
+
+        auto smallMoved = std::move(smallCopy);
+        REQUIRE(smallMoved.isInline());
+        REQUIRE(smallCopy.empty());
+        auto data = largeCopy.data();
+        auto largeMoved = std::move(largeCopy);
+        REQUIRE(largeMoved.data() == data);
+        REQUIRE(largeCopy.empty());
+        REQUIRE(largeCopy.isInline());
+
+        smallMoved = std::move(largeMoved);
+        REQUIRE(smallMoved == large);
+        REQUIRE(largeMoved.empty());
+        smallMoved = small;
+        REQUIRE(smallMoved == small);
+        largeMoved = std::move(smallMoved);
+        REQUIRE(largeMoved == small);
+    }
+
+    SECTION("Append") {
+        SmallVector<int, 4> vector = {1, 2};
+        SmallVector<int, 2> other = {3, 4, 5};
+        vector.append(std::move(other));
+        REQUIRE(other.empty());
+        int const more[] = {6};
+        vector.append(more);
+        REQUIRE(vector == SmallVector<int, 4>{1, 2, 3, 4, 5, 6});
+    }
+
+    SECTION("No Inline Storage") {
+        SmallVector<int, 0> vector;
+        REQUIRE(vector.capacity() == 0);
+        vector.pushBack(1);
+        REQUIRE(!vector.isInline());
+        REQUIRE(vector.front() == 1);
+    }
+}
+
+TEST_CASE("Validated") {
+    SECTION("Valid") {
+        auto res = validateSignup("alice", 30, "correct horse");
+        REQUIRE(res.isOk());
+        REQUIRE(res.errors().empty());
+        auto signup = std::move(res).unwrap();
+        REQUIRE(signup.name == "alice");
+        REQUIRE(signup.age == 30);
+    }
+
+    SECTION("Every Error") {
+        auto res = validateSignup("", -1, "short");
+        REQUIRE(res.isErr());
+        auto errors = res.errors();
+        REQUIRE(errors.size() == 3);
+        REQUIRE(errors[0] == "name is empty");
+        REQUIRE(errors[1] == "age is negative");
+        REQUIRE(errors[2] == "password is too short");
+
+        auto partial = validateSignup("bob", -1, "correct horse");
+        REQUIRE(partial.errors().size() == 1);
+        REQUIRE(partial.errors()[0] == "age is negative");
+    }
+
+    SECTION("Unwrap") {
+        auto res = validateSignup("", 1, "correct horse");
+        try {
+            (void)res.unwrap();
+            FAIL("Expected UnwrapException to be thrown");
+        }
+        catch (UnwrapException const& e) {
+            REQUIRE(e.what() == std::string("Called unwrap on an Err Result: name is empty"));
+        }
+    }
+
+    SECTION("Spill") {
+        Validated<void, int, 2> checks = combine(
+            [] {}, check<int, 2>(false, 1), check<int, 2>(true, 2), check<int, 2>(false, 3), check<int, 2>(false, 4)
+        );
+        REQUIRE(checks.errors().size() == 3);
+        REQUIRE(checks.errors()[2] == 4);
+        auto errors = std::move(checks).unwrapErrors();
+        REQUIRE(!errors.isInline());
+    }
+
+    SECTION("Lvalues") {
+        auto name = validateName("carol");
+        auto age = validateAge(-5);
+        auto res = combine(
+            [](std::string const& name, int age) {
+                return name.size() + age;
+            },
+            name,
+            age
+        );
+        REQUIRE(res.errors().size() == 1);
+        REQUIRE(name.unwrap() == "carol");
+        REQUIRE(age.errors().size() == 1);
+    }
+
+    SECTION("From Result") {
+        Result<int> ok = Ok(2);
+        Result<int> err = Err("bad");
+        Validated<int> fromOk = ok;
+        Validated<int> fromErr = std::move(err);
+        REQUIRE(fromOk.unwrap() == 2);
+        REQUIRE(fromErr.errors()[0] == "bad");
+        Validated<void> fromVoid = Result<void>(Ok());
+        REQUIRE(fromVoid.isOk());
+    }
+
+    SECTION("To Result") {
+        Result<Signup, SmallVector<std::string, 4>> ok = validateSignup("dave", 40, "correct horse");
+        REQUIRE(ok.unwrap().name == "dave");
+        auto err = validateSignup("", 40, "short").toResult();
+        REQUIRE(err.unwrapErr().size() == 2);
+        auto const invalid = validateAge(-1);
+        REQUIRE(invalid.toResult().unwrapErr()[0] == "age is negative");
+        REQUIRE(invalid.isErr());
+    }
+
+    SECTION("Map") {
+        auto doubled = validateAge(21).map([](int age) {
+            return age * 2;
+        });
+        REQUIRE(doubled.unwrap() == 42);
+        auto failed = validateAge(-1).map([](int age) {
+            return age * 2;
+        });
+        REQUIRE(failed.errors()[0] == "age is negative");
+        int calls = 0;
+        auto fromVoid = check(true, "unused").map([&] {
+            return ++calls;
+        });
+        REQUIRE(fromVoid.unwrap() == 1);
+    }
+
+    SECTION("Checks Do Not Allocate When Valid") {
+        // longer than the small string buffer, so building it would allocate
+        constexpr auto message = "password is too short for this service";
+        g_errorAllocations = 0;
+        auto valid = combine(
+            [] {},
+            check<CountedString>(true, message),
+            check<CountedString>(true, message),
+            check<CountedString>(true, message)
+        );
+        REQUIRE(valid.isOk());
+        REQUIRE(g_errorAllocations == 0);
+
+        auto invalid = check<CountedString>(false, message);
+        REQUIRE(invalid.errors()[0] == message);
+        REQUIRE(g_errorAllocations == 1);
+    }
+
+    SECTION("Add Errors") {
+        auto res = validateAge(3);
+        res.addErrors(SmallVector<std::string, 4>());
+        REQUIRE(res.isOk());
+        res.addErrors(SmallVector<std::string, 4>{"too young"});
+        REQUIRE(res.isErr());
+        REQUIRE(res.errors()[0] == "too young");
+    }
+}
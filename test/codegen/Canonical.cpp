@@ -0,0 +1,184 @@
+// Canonical functions written once with Result and once with a hand written
+// tagged struct (and with std::expected when available). The Compare.cmake
+// script checks that the Result version of each function is not measurably
+// larger than the raw one.
+#include <Geode/Result.hpp>
+
+#if __has_include(<expected>)
+    #include <expected>
+#endif
+
+using namespace geode;
+
+namespace {
+    struct Tagged {
+        union {
+            int ok;
+            int err;
+        };
+        bool isOk;
+    };
+
+    struct TaggedVoid {
+        int err;
+        bool isOk;
+    };
+
+    constexpr Result<int, int> divideResult(int a, int b) {
+        if (b == 0) {
+            return Err(-1);
+        }
+        else {
+            return Ok(a / b);
+        }
+    }
+
+    constexpr Tagged divideRaw(int a, int b) {
+        if (b == 0) {
+            Tagged res{};
+            res.err = -1;
+            res.isOk = false;
+            return res;
+        }
+        else {
+            Tagged res{};
+            res.ok = a / b;
+            res.isOk = true;
+            return res;
+        }
+    }
+
+#if __cpp_lib_expected >= 202202L
+    constexpr std::expected<int, int> divideExpected(int a, int b) {
+        if (b == 0) {
+            return std::unexpected(-1);
+        }
+        else {
+            return a / b;
+        }
+    }
+#endif
+}
+
+// divideConstexpr from test/Misc.cpp
+
+extern "C" Result<int, int> geode_codegen_divide_result(int a, int b) {
+    return divideResult(a, b);
+}
+
+extern "C" Tagged geode_codegen_divide_raw(int a, int b) {
+    return divideRaw(a, b);
+}
+
+#if __cpp_lib_expected >= 202202L
+extern "C" std::expected<int, int> geode_codegen_divide_expected(int a, int b) {
+    return divideExpected(a, b);
+}
+#endif
+
+// A chain of early returns
+
+extern "C" Result<int, int> geode_codegen_chain_result(int a, int b, int c) {
+    GEODE_UNWRAP_INTO(int first, divideResult(a, b));
+    GEODE_UNWRAP_INTO(int second, divideResult(first, c));
+    return Ok(first + second);
+}
+
+extern "C" Tagged geode_codegen_chain_raw(int a, int b, int c) {
+    auto first = divideRaw(a, b);
+    if (!first.isOk) {
+        return first;
+    }
+    auto second = divideRaw(first.ok, c);
+    if (!second.isOk) {
+        return second;
+    }
+    Tagged res{};
+    res.ok = first.ok + second.ok;
+    res.isOk = true;
+    return res;
+}
+
+#if __cpp_lib_expected >= 202202L
+extern "C" std::expected<int, int> geode_codegen_chain_expected(int a, int b, int c) {
+    auto first = divideExpected(a, b);
+    if (!first) {
+        return std::unexpected(first.error());
+    }
+    auto second = divideExpected(*first, c);
+    if (!second) {
+        return std::unexpected(second.error());
+    }
+    return *first + *second;
+}
+#endif
+
+// mapOr on a Result passed by value
+
+extern "C" int geode_codegen_mapor_result(Result<int, int> res) {
+    return res.mapOr(0, [](int value) {
+        return value * 2;
+    });
+}
+
+extern "C" int geode_codegen_mapor_raw(Tagged res) {
+    return res.isOk ? res.ok * 2 : 0;
+}
+
+#if __cpp_lib_expected >= 202202L
+extern "C" int geode_codegen_mapor_expected(std::expected<int, int> res) {
+    return res ? *res * 2 : 0;
+}
+#endif
+
+// unwrapOr on a Result passed by reference
+
+extern "C" int geode_codegen_unwrapor_result(Result<int, int> const& res) {
+    return res.unwrapOr(0);
+}
+
+extern "C" int geode_codegen_unwrapor_raw(Tagged const& res) {
+    return res.isOk ? res.ok : 0;
+}
+
+#if __cpp_lib_expected >= 202202L
+extern "C" int geode_codegen_unwrapor_expected(std::expected<int, int> const& res) {
+    return res.value_or(0);
+}
+#endif
+
+// A Result with a void Ok side
+
+extern "C" Result<void, int> geode_codegen_check_result(int value) {
+    if (value < 0) {
+        return Err(value);
+    }
+    return Ok();
+}
+
+extern "C" TaggedVoid geode_codegen_check_raw(int value) {
+    if (value < 0) {
+        return TaggedVoid{value, false};
+    }
+    return TaggedVoid{0, true};
+}
+
+// A niche optimized reference
+
+extern "C" Result<int&, void> geode_codegen_find_result(int* values, int count, int value) {
+    for (int i = 0; i < count; ++i) {
+        if (values[i] == value) {
+            return Ok(values[i]);
+        }
+    }
+    return Err();
+}
+
+extern "C" int* geode_codegen_find_raw(int* values, int count, int value) {
+    for (int i = 0; i < count; ++i) {
+        if (values[i] == value) {
+            return &values[i];
+        }
+    }
+    return nullptr;
+}
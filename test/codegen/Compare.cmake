@@ -0,0 +1,94 @@
+# Counts the instructions of every geode_codegen_<name>_<variant> function in
+# OBJECT and fails when a _result variant is larger than its _raw or _expected
+# counterpart by more than TOLERANCE percent plus SLACK instructions, and the
+# allowance recorded below for that function and COMPILER (<id>_<major version>)
+
+# Compilers whose counts have been measured. Any other compiler may lay out the
+# hand written functions differently, so its counts are only reported
+set(measured GNU_12)
+
+# Known differences, as allowance_<compiler>_<name>_<variant>. Each one is the
+# exact gap measured when it was recorded, so any growth still fails
+
+# GCC 12 tests the second divisor before the first division in the hand written
+# chain, but not in the Result or std::expected ones (21 instructions for both)
+set(allowance_GNU_12_chain_raw 4)
+
+if (NOT DEFINED TOLERANCE)
+    set(TOLERANCE 0)
+endif()
+if (NOT DEFINED SLACK)
+    set(SLACK 1)
+endif()
+
+if (NOT OBJDUMP)
+    message(FATAL_ERROR "Codegen checks need objdump")
+endif()
+
+execute_process(
+    COMMAND ${OBJDUMP} -d --no-show-raw-insn ${OBJECT}
+    OUTPUT_VARIABLE disassembly
+    COMMAND_ERROR_IS_FATAL ANY
+)
+
+string(REPLACE ";" "," disassembly "${disassembly}")
+string(REPLACE "\n" ";" lines "${disassembly}")
+
+set(names)
+set(current)
+foreach (line IN LISTS lines)
+    if (line MATCHES "<_?geode_codegen_([a-z]+)_([a-z]+)>:$")
+        set(current "${CMAKE_MATCH_1}_${CMAKE_MATCH_2}")
+        set(count_${current} 0)
+        list(APPEND names ${CMAKE_MATCH_1})
+    elseif (line MATCHES "^[0-9a-f]+ <")
+        set(current)
+    elseif (current AND line MATCHES "^ +[0-9a-f]+:\t+([a-z0-9]+)")
+        # alignment padding between functions
+        if (NOT CMAKE_MATCH_1 MATCHES "^(nop|data16|int3|xchg|cs)")
+            math(EXPR count_${current} "${count_${current}} + 1")
+        endif()
+    endif()
+endforeach()
+
+list(REMOVE_DUPLICATES names)
+if (NOT names)
+    message(FATAL_ERROR "No codegen functions found in ${OBJECT}")
+endif()
+
+set(failed FALSE)
+foreach (name IN LISTS names)
+    if (NOT DEFINED count_${name}_result)
+        continue()
+    endif()
+    set(result ${count_${name}_result})
+    set(report "${name}: result ${result}")
+    foreach (variant raw expected)
+        if (NOT DEFINED count_${name}_${variant})
+            continue()
+        endif()
+        set(baseline ${count_${name}_${variant}})
+        set(allowance 0)
+        if (DEFINED allowance_${COMPILER}_${name}_${variant})
+            set(allowance ${allowance_${COMPILER}_${name}_${variant}})
+        endif()
+        math(EXPR limit "${baseline} + ${baseline} * ${TOLERANCE} / 100 + ${SLACK} + ${allowance}")
+        string(APPEND report ", ${variant} ${baseline}")
+        if (result GREATER limit)
+            string(APPEND report " (limit ${limit} exceeded)")
+            set(failed TRUE)
+        endif()
+    endforeach()
+    message(STATUS "${report}")
+endforeach()
+
+# IN_LIST is not available to scripts without setting a policy
+list(FIND measured "${COMPILER}" measuredIndex)
+if (failed)
+    if (measuredIndex GREATER -1)
+        message(FATAL_ERROR "Result codegen is heavier than the hand written equivalent")
+    else()
+        message(WARNING "Result codegen is heavier than the hand written equivalent, which is "
+            "not enforced since no counts have been measured for ${COMPILER}")
+    endif()
+endif()